@@ -109,6 +109,14 @@ run --no-contracts -a -p
 run --no-tracing -q
 run --no-tracing -a -p
 
+run --compact-watches -q
+run --compact-watches -c
+run --compact-watches -a -p
+
+run --packed-vars -q
+run --packed-vars -c
+run --packed-vars -a -p
+
 run -m32 -q
 run -m32 -a -p
 
@@ -0,0 +1,80 @@
+#!/bin/sh
+
+# Compares propagation speed of the default 16 byte watches with compact
+# 8 byte watches ('../configure --compact-watches') on the given CNF files.
+# Both configurations are built (if not already present) in the directories
+# 'bench-default' and 'bench-compact' below the root directory.
+
+. `dirname $0`/colors.sh || exit 1
+
+############################################################################
+
+die () {
+  echo "compare-compact-watches.sh: ${BAD}error${NORMAL}: $*" 1>&2
+  exit 1
+}
+
+msg () {
+  echo "compare-compact-watches.sh: $*"
+}
+
+############################################################################
+
+root="`dirname $0`/.."
+root="`cd $root; pwd`"
+
+[ -f "$root/configure" ] || die "can not find '$root/configure'"
+[ $# = 0 ] && die "expected at least one CNF file"
+
+for cnf in $*
+do
+  [ -f "$cnf" ] || die "can not find CNF file '$cnf'"
+done
+
+# The 'configure' script overwrites the proxy 'makefile' in the root
+# directory (and links 'src/makefile' to it), so we save and restore it or
+# remove both if there was none.  The 'bench-*' build directories are
+# ignored by 'git'.
+
+if [ -f "$root/makefile" ]
+then
+  saved="/tmp/compare-compact-watches-$$.makefile"
+  cp "$root/makefile" "$saved" || exit 1
+  trap "mv \"$saved\" \"$root/makefile\"" 0
+else
+  trap "rm -f \"$root/makefile\" \"$root/src/makefile\"" 0
+fi
+
+build () {
+  dir="$root/bench-$1"
+  shift
+  if [ ! -x "$dir/cadical" ]
+  then
+    msg "building '$dir' with '../configure $*'"
+    mkdir -p "$dir" || exit 1
+    ( cd "$dir" && ../configure $* >/dev/null 2>&1 && make cadical \
+      >/dev/null 2>&1 ) || die "building '$dir' failed"
+  fi
+}
+
+build default
+build compact --compact-watches
+
+############################################################################
+
+speed () {
+  "$root/bench-$1/cadical" -n "$2" 2>/dev/null | \
+  awk '/^c propagations:/{print $4}'
+}
+
+printf "%-40s %12s %12s %8s\n" "CNF" "default" "compact" "ratio"
+for cnf in $*
+do
+  default="`speed default $cnf`"
+  compact="`speed compact $cnf`"
+  [ "$default" = "" -o "$compact" = "" ] && \
+    die "could not determine propagation speed on '$cnf'"
+  ratio="`echo \"$compact $default\" | awk '{printf \"%.2f\", $1/$2}'`"
+  printf "%-40s %10s M %10s M %8s\n" "`basename $cnf`" \
+    "$default" "$compact" "$ratio"
+done
@@ -0,0 +1,84 @@
+#!/bin/sh
+
+# Compares the time spent in 'analyze' and 'propagate' of the default
+# scattered variable tables with the packed variable records ('../configure
+# --packed-vars') on the given CNF files.  Both configurations are built (if
+# not already present) in the directories 'bench-default' and 'bench-packed'
+# below the root directory.  The times are taken from the profile.
+
+. `dirname $0`/colors.sh || exit 1
+
+############################################################################
+
+die () {
+  echo "compare-packed-vars.sh: ${BAD}error${NORMAL}: $*" 1>&2
+  exit 1
+}
+
+msg () {
+  echo "compare-packed-vars.sh: $*"
+}
+
+############################################################################
+
+root="`dirname $0`/.."
+root="`cd $root; pwd`"
+
+[ -f "$root/configure" ] || die "can not find '$root/configure'"
+[ $# = 0 ] && die "expected at least one CNF file"
+
+for cnf in $*
+do
+  [ -f "$cnf" ] || die "can not find CNF file '$cnf'"
+done
+
+# The 'configure' script overwrites the proxy 'makefile' in the root
+# directory (and links 'src/makefile' to it), so we save and restore it or
+# remove both if there was none.  The 'bench-*' build directories are
+# ignored by 'git'.
+
+if [ -f "$root/makefile" ]
+then
+  saved="/tmp/compare-packed-vars-$$.makefile"
+  cp "$root/makefile" "$saved" || exit 1
+  trap "mv \"$saved\" \"$root/makefile\"" 0
+else
+  trap "rm -f \"$root/makefile\" \"$root/src/makefile\"" 0
+fi
+
+build () {
+  dir="$root/bench-$1"
+  shift
+  if [ ! -x "$dir/cadical" ]
+  then
+    msg "building '$dir' with '../configure $*'"
+    mkdir -p "$dir" || exit 1
+    ( cd "$dir" && ../configure $* >/dev/null 2>&1 && make cadical \
+      >/dev/null 2>&1 ) || die "building '$dir' failed"
+  fi
+}
+
+build default
+build packed --packed-vars
+
+############################################################################
+
+profile () {
+  "$root/bench-$1/cadical" -n --profile=4 "$2" 2>/dev/null | \
+  awk '/^c  *[0-9.]*  *[0-9.]*% analyze$/{a=$2}
+       /^c  *[0-9.]*  *[0-9.]*% propagate$/{p=$2}
+       END{if (a != "" && p != "") print a, p}'
+}
+
+printf "%-32s %9s %9s %7s %9s %9s %7s\n" "CNF" \
+  "analyze" "packed" "ratio" "propagate" "packed" "ratio"
+for cnf in $*
+do
+  default="`profile default $cnf`"
+  packed="`profile packed $cnf`"
+  [ "$default" = "" -o "$packed" = "" ] && \
+    die "could not determine profile on '$cnf'"
+  echo "`basename $cnf` $default $packed" | \
+  awk '{printf "%-32s %9.2f %9.2f %7.2f %9.2f %9.2f %7.2f\n", \
+    $1, $2, $4, ($2 ? $4/$2 : 1), $3, $5, ($3 ? $5/$3 : 1)}'
+done
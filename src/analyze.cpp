@@ -94,6 +94,7 @@ void Internal::rescale_variable_scores () {
   double factor = 1.0 / divider;
   for (auto idx : vars)
     stab[idx] *= factor;
+  scores.rescale (factor);
   score_inc *= factor;
   PHASE ("rescore", stats.rescored,
          "new score increment %g after %" PRId64 " conflicts", score_inc,
@@ -123,7 +124,9 @@ void Internal::bump_variable_score (int lit) {
 // Important variables recently used in conflict analysis are 'bumped',
 
 void Internal::bump_variable (int lit) {
-  if (use_scores ())
+  if (use_scores () && chb)
+    bump_variable_chb (lit);
+  else if (use_scores ())
     bump_variable_score (lit);
   else
     bump_queue (lit);
@@ -194,7 +197,9 @@ void Internal::bump_variables () {
   for (const auto &lit : analyzed)
     bump_variable (lit);
 
-  if (use_scores ())
+  if (use_scores () && chb)
+    update_chb_step ();
+  else if (use_scores ())
     bump_variable_score_inc ();
 
   STOP (bump);
@@ -220,22 +225,30 @@ int Internal::recompute_glue (Clause *c) {
 
 // Clauses resolved since the last reduction are marked as 'used', their
 // glue is recomputed and they are promoted if the glue shrinks.  Note that
-// promotion from 'tier3' to 'tier2' will set 'used' to '2'.
+// promotion from 'tier3' to 'tier2' will set 'used' to '2'.  The glue of
+// used redundant clauses is counted in 'glue_used' to adapt the tier
+// boundaries in 'recompute_tiers' (see 'reduce.cpp').
 
 inline void Internal::bump_clause (Clause *c) {
   LOG (c, "bumping");
   unsigned used = c->used;
   c->used = 1;
-  if (c->keep)
-    return;
   if (c->hyper)
     return;
   if (!c->redundant)
     return;
+  if (opts.reducetieradapt) {
+    const unsigned glue = c->glue;
+    if (glue >= glue_used.size ())
+      glue_used.resize (glue + 1, 0);
+    glue_used[glue]++;
+  }
+  if (c->keep)
+    return;
   int new_glue = recompute_glue (c);
   if (new_glue < c->glue)
     promote_clause (c, new_glue);
-  else if (used && c->glue <= opts.reducetier2glue)
+  else if (used && c->glue <= lim.tier2glue)
     c->used = 2;
 }
 
@@ -299,7 +312,7 @@ inline void Internal::analyze_reason (int lit, Clause *reason, int &open,
   assert (reason != external_reason);
   bump_clause (reason);
   if (lrat)
-    lrat_chain.push_back (reason->id);
+    lrat_chain.push_back (reason->id ());
   for (const auto &other : *reason)
     if (other != lit)
       analyze_literal (other, open, resolvent_size, antecedent_size);
@@ -472,8 +485,20 @@ Clause *Internal::new_driving_clause (const int glue, int &jump) {
            analyze_trail_negative_rank (this), analyze_trail_larger (this));
 
     jump = var (clause[1]).level;
-    res = new_learned_redundant_clause (glue);
-    res->used = 1 + (glue <= opts.reducetier2glue);
+
+    // Reuse an identical learned clause if indexed (see 'learnhash.cpp').
+    //
+    const bool hashed = opts.learnhash && size > 2;
+    const uint64_t hash = hashed ? hash_learned_clause () : 0;
+    res = hashed ? find_learned_clause (hash) : 0;
+    if (res)
+      reuse_learned_clause (res, glue);
+    else {
+      res = new_learned_redundant_clause (glue);
+      res->used = 1 + (glue <= lim.tier2glue);
+      if (hashed)
+        index_learned_clause (res, hash);
+    }
   }
 
   LOG ("jump level %d", jump);
@@ -566,14 +591,16 @@ inline int Internal::find_conflict_level (int &forced) {
 
     if (highest_position > 1) {
       LOG (conflict, "unwatch %d in", lit);
-      remove_watch (watches (lit), conflict);
+      unwatch_literal (lit, conflict);
     }
 
     lits[highest_position] = lit;
     lits[i] = highest_literal;
 
-    if (highest_position > 1)
+    if (highest_position > 1) {
+      unbury_watch (highest_literal, conflict);
       watch_literal (highest_literal, lits[!i], conflict);
+    }
   }
 
   // Only if the number of highest level literals in the conflict is one
@@ -742,10 +769,10 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
   LOG (new_conflict, "putting uip at pos 1");
 
   if (other_init != other)
-    remove_watch (watches (other_init), new_conflict);
-  remove_watch (watches (uip), new_conflict);
+    unwatch_literal (other_init, new_conflict);
+  unwatch_literal (uip, new_conflict);
 
-  assert (!lrat || lrat_chain.back () == new_conflict->id);
+  assert (!lrat || lrat_chain.back () == new_conflict->id ());
   if (lrat) {
     assert (!lrat_chain.empty ());
     for (const auto &id : unit_chain) {
@@ -785,11 +812,13 @@ Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
     assert (new_size == new_conflict->size);
   }
 
-  if (other_init != other)
+  if (other_init != other) {
+    unbury_watch (other, new_conflict);
     watch_literal (other, lits[1], new_conflict);
-  else {
+  } else {
     update_watch_size (watches (other), lits[1], new_conflict);
   }
+  unbury_watch (lits[1], new_conflict);
   watch_literal (lits[1], other, new_conflict);
 
   LOG (new_conflict, "strengthened clause by OTFS");
@@ -815,7 +844,7 @@ inline void Internal::otfs_subsume_clause (Clause *subsuming,
   LOG ("turning redundant subsuming clause into irredundant clause");
   subsuming->redundant = false;
   if (proof)
-    proof->strengthen (subsuming->id);
+    proof->strengthen (subsuming->id ());
   mark_garbage (subsumed);
   stats.current.irredundant++;
   stats.added.irredundant++;
@@ -1091,6 +1120,9 @@ void Internal::analyze () {
     else if (opts.minimize)
       minimize_clause ();
 
+    if (opts.minimizebin && !lrat && clause.size () > 2)
+      minimize_clause_binary (uip);
+
     size = (int) clause.size ();
 
     // Update decision heuristics.
@@ -1129,6 +1161,7 @@ void Internal::analyze () {
 
   int new_level = determine_actual_backtrack_level (jump);
   UPDATE_AVERAGE (averages.current.level, new_level);
+  save_trail (new_level);
   backtrack (new_level);
 
   // It should hold that (!level <=> size == 1)
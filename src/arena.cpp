@@ -3,28 +3,238 @@
 namespace CaDiCaL {
 
 Arena::Arena (Internal *i) {
-  memset (this, 0, sizeof *this);
   internal = i;
+  to.start = to.top = to.end = 0;
+  mature = wasted = 0;
+  nursery.start = nursery.top = nursery.end = 0;
+#ifdef COMPACTWATCHES
+  nursery.page = 0;
+  collecting = false;
+#endif
 }
 
 Arena::~Arena () {
-  delete[] from.start;
-  delete[] to.start;
+  for (const auto &b : blocks)
+    release (b);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Allocate a new block and keep the blocks sorted.  With compact watches
+// the block is also registered in the page table, which requires a range
+// of consecutive free pages.  Otherwise the block is not directly
+// addressable and references to it are 'far'.  If requested by 'hugepages'
+// and 'huge' is set the block is rounded up to and aligned on 2 MB, which
+// is the size of a transparent huge page, and falls back to 'new' if that
+// does not work.
+
+const Arena::Block &Arena::new_block (size_t bytes, bool young,
+                                      bool huge) {
+  if (!bytes)
+    bytes = 8;
+  Block b;
+  b.start = 0;
+  if (huge && internal->opts.hugepages) {
+    bytes = align (bytes, huge_page_bytes);
+    b.start = allocate_huge_pages (bytes);
+  }
+  b.huge = b.start;
+  if (!b.huge)
+    b.start = new char[bytes];
+  b.end = b.start + bytes;
+  b.young = young;
+#ifdef COMPACTWATCHES
+  b.page = invalid_page;
+  const size_t needed = (bytes + page_bytes - 1) / page_bytes;
+  size_t run = 0, page = 0;
+  while (run < needed && page < pages.size ())
+    if (pages[page++])
+      run = 0;
+    else
+      run++;
+  if (run < needed && needed - run <= max_pages - pages.size ()) {
+    pages.resize (pages.size () + needed - run);
+    page = pages.size ();
+    run = needed;
+  }
+  if (run == needed) {
+    b.page = (unsigned) (page - needed);
+    for (size_t i = 0; i < needed; i++)
+      pages[b.page + i] = b.start + i * page_bytes;
+  }
+  LOG ("new arena block of %zd bytes at %p with %s", bytes,
+       (void *) b.start,
+       b.page == invalid_page ? "far references" : "registered pages");
+#else
+  LOG ("new arena block of %zd bytes at %p", bytes, (void *) b.start);
+#endif
+  auto pos = blocks.begin ();
+  while (pos != blocks.end () && pos->start < b.start)
+    pos++;
+  return *blocks.insert (pos, b);
+}
+
+void Arena::delete_block (const Block &b) {
+  LOG ("delete arena block of %zd bytes at %p",
+       (size_t) (b.end - b.start), (void *) b.start);
+#ifdef COMPACTWATCHES
+  if (b.page != invalid_page) {
+    const size_t needed = (b.end - b.start + page_bytes - 1) / page_bytes;
+    for (size_t i = 0; i < needed; i++)
+      pages[b.page + i] = 0;
+  }
+#endif
+  release (b);
+}
+
+void Arena::release (const Block &b) {
+  if (b.huge)
+    deallocate_huge_pages (b.start);
+  else
+    delete[] b.start;
+}
+
+size_t Arena::huge_bytes () const {
+  size_t res = 0;
+  for (const auto &b : blocks)
+    if (b.huge)
+      res += b.end - b.start;
+  return res;
+}
+
+const Arena::Block *Arena::find_block (const char *p) const {
+  size_t l = 0, r = blocks.size ();
+  while (l < r) {
+    const size_t m = l + (r - l) / 2;
+    const Block &b = blocks[m];
+    if (p < b.start)
+      r = m;
+    else if (p >= b.end)
+      l = m + 1;
+    else
+      return &b;
+  }
+  return 0;
+}
+
+char *Arena::new_nursery_chunk (size_t bytes) {
+  size_t chunk = nursery_bytes;
+  if (bytes > chunk)
+    chunk = bytes;
+  const Block &b = new_block (chunk, true);
+  nursery.start = nursery.top = b.start;
+  nursery.end = b.end;
+#ifdef COMPACTWATCHES
+  nursery.page = b.page;
+#endif
+  return nursery.start;
 }
 
-void Arena::prepare (size_t bytes) {
+/*------------------------------------------------------------------------*/
+
+// With compact watches the references to mature clauses are not updated
+// in a minor collection and thus their far references have to be kept.
+
+// The 'to' space of a minor collection is kept as additional mature block
+// and usually small.  Rounding it up to a huge page would add padding to
+// every minor collection, which is neither counted as mature nor as wasted
+// memory and thus would never trigger a major collection to reclaim it.
+// Therefore only the 'to' space of a major collection (holding all mature
+// clauses) and nursery chunks (of huge page size anyhow) use huge pages.
+
+void Arena::prepare (size_t bytes, bool minor) {
   LOG ("preparing 'to' space of arena with %zd bytes", bytes);
   assert (!to.start);
-  to.top = to.start = new char[bytes];
+  to.top = to.start = new_block (bytes, false, !minor).start;
   to.end = to.start + bytes;
+#ifdef COMPACTWATCHES
+  assert (!collecting);
+  assert (next_far.empty ());
+  if (minor)
+    next_far = far, next_far_refs = far_refs;
+  collecting = true;
+#endif
 }
 
+// Release all blocks except the 'to' space, i.e., all mature blocks and
+// nursery chunks, since all surviving clauses have been copied.
+
 void Arena::swap () {
-  delete[] from.start;
-  LOG ("delete 'from' space of arena with %zd bytes",
-       (size_t) (from.end - from.start));
-  from = to;
+  LOG ("delete %zd bytes of mature arena blocks", mature);
+  size_t kept = 0;
+  for (const auto &b : blocks)
+    if (b.start == to.start)
+      blocks[kept++] = b;
+    else
+      delete_block (b);
+  blocks.resize (kept);
+  mature = to.top - to.start;
+  wasted = 0;
+  to.start = to.top = to.end = 0;
+  nursery.start = nursery.top = nursery.end = 0;
+#ifdef COMPACTWATCHES
+  assert (collecting);
+  far.swap (next_far);
+  next_far.clear ();
+  far_refs.swap (next_far_refs);
+  next_far_refs.clear ();
+  collecting = false;
+#endif
+}
+
+// Release only the nursery chunks, since all surviving young clauses have
+// been copied to the 'to' space, which is kept as another mature block.
+
+void Arena::promote () {
+  LOG ("promoting %zd bytes to mature arena blocks",
+       (size_t) (to.top - to.start));
+  size_t kept = 0;
+  for (const auto &b : blocks)
+    if (b.young)
+      delete_block (b);
+    else
+      blocks[kept++] = b;
+  blocks.resize (kept);
+  mature += to.top - to.start;
   to.start = to.top = to.end = 0;
+  nursery.start = nursery.top = nursery.end = 0;
+#ifdef COMPACTWATCHES
+  assert (collecting);
+  far.swap (next_far);
+  next_far.clear ();
+  far_refs.swap (next_far_refs);
+  next_far_refs.clear ();
+  collecting = false;
+#endif
 }
 
+/*------------------------------------------------------------------------*/
+
+#ifdef COMPACTWATCHES
+
+// Far references are indices into a table of pointers.  They are only
+// valid until the next 'swap', since moving garbage collection updates all
+// watches and then produces new references in 'next_far'.  Every watch of
+// a clause needs a reference, thus the index of a clause is remembered
+// and reused (otherwise propagation would keep growing the table).
+
+unsigned Arena::far_reference (const char *p) {
+  vector<char *> &table = collecting ? next_far : far;
+  auto &refs = collecting ? next_far_refs : far_refs;
+  const auto it = refs.find (p);
+  if (it != refs.end ()) {
+    assert (table[it->second >> 2] == p);
+    return it->second;
+  }
+  const size_t idx = table.size ();
+  if (idx >= (1u << 30))
+    fatal ("too many far clause references");
+  table.push_back ((char *) p);
+  const unsigned res = (unsigned) (idx << 2) | 2;
+  refs[p] = res;
+  return res;
+}
+
+#endif
+
 } // namespace CaDiCaL
@@ -1,8 +1,15 @@
 #ifndef _arena_hpp_INCLUDED
 #define _arena_hpp_INCLUDED
 
+#include <cassert>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
 namespace CaDiCaL {
 
+using namespace std;
+
 // This memory allocation arena provides fixed size pre-allocated memory for
 // the moving garbage collector 'copy_non_garbage_clauses' in 'collect.cpp'
 // to hold clauses which should survive garbage collection.
@@ -28,6 +35,23 @@ namespace CaDiCaL {
 // compared by varying the 'opts.arenatype' option (which also controls the
 // allocation order of clauses during moving them).
 
+// Unless 'opts.arenanursery' is disabled, new clauses are not allocated
+// individually on the heap though, but with a bump pointer in 'nursery'
+// chunks of 2 MB allocated by the arena.  This avoids the 'malloc' and
+// 'free' overhead on the conflict path and keeps recently learned clauses
+// close to each other.  Nursery clauses are never deleted individually.
+// Instead all nursery chunks are released during 'swap', after the moving
+// garbage collector copied all surviving clauses to the 'to' space.
+
+// Unless 'opts.arenaminor' is disabled, garbage collection is generational.
+// Blocks holding clauses which survived a collection are 'mature'.  A minor
+// collection only copies the surviving 'young' clauses (in the nursery or
+// allocated outside of the arena) to a new 'to' space, which after
+// 'promote' becomes another mature block, and keeps all other mature
+// blocks.  Memory of garbage clauses in mature blocks is then 'wasted'
+// until the next major collection, which copies all surviving clauses and
+// with 'swap' releases all other blocks.
+
 // The standard sequence of using the arena is as follows:
 //
 //   Arena arena;
@@ -51,6 +75,21 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// If compiled with '-DCOMPACTWATCHES' (configured '--compact-watches') the
+// watches only hold a 32-bit 'reference' to the clause instead of a 64-bit
+// pointer, which halves the size of watches from 16 to 8 bytes.  Then all
+// clauses are allocated in the arena, new clauses in 'nursery' chunks with
+// a simple bump pointer.  Each memory block of the arena is split into
+// windows of 2 MB (2^18 words of 8 bytes) which are registered in a page
+// table of 4096 entries.  A reference consists of the page index (12 bits),
+// the word offset within that page (18 bits), a 'far' flag and a flag for
+// binary clauses (used by the watches).  This allows to address 8 GB of
+// clauses directly.  If the page table is exhausted the new blocks are not
+// registered and references to clauses in such blocks are then 'far', i.e.,
+// an index into a table of pointers, which is rebuilt during moving garbage
+// collection (the only time where all watches are updated).  This indirect
+// fall-back is slower but keeps the solver working beyond 8 GB of clauses.
+
 struct Internal;
 
 class Arena {
@@ -59,7 +98,73 @@ class Arena {
 
   struct {
     char *start, *top, *end;
-  } from, to;
+  } to;
+
+  size_t mature; // bytes of clauses in mature blocks
+  size_t wasted; // bytes of garbage clauses in mature blocks
+
+  static const size_t nursery_bytes = 1u << 21;
+
+#ifdef COMPACTWATCHES
+  static const unsigned page_bits = 12;
+  static const unsigned word_bits = 18;
+  static const unsigned max_pages = 1u << page_bits;
+  static const size_t page_bytes = ((size_t) 8) << word_bits;
+  static const unsigned invalid_page = ~0u;
+#endif
+
+  // All memory of the arena (mature, 'to' space and nursery chunks) is
+  // allocated in blocks, which are kept sorted to find those of a clause.
+  //
+  struct Block {
+    char *start, *end;
+    bool young; // nursery chunk
+    bool huge;  // allocated with 'allocate_huge_pages'
+#ifdef COMPACTWATCHES
+    unsigned page; // first page table entry or 'invalid_page'
+#endif
+  };
+
+  vector<Block> blocks; // all allocated blocks sorted by 'start'
+
+  struct {
+    char *start, *top, *end;
+#ifdef COMPACTWATCHES
+    unsigned page;
+#endif
+  } nursery; // current chunk for new clauses
+
+  const Block &new_block (size_t bytes, bool young = false,
+                         bool huge = true);
+  void delete_block (const Block &);
+  static void release (const Block &);
+  const Block *find_block (const char *) const;
+  char *new_nursery_chunk (size_t bytes);
+
+#ifdef COMPACTWATCHES
+
+  vector<char *> pages; // start addresses of registered 2 MB windows
+
+  vector<char *> far, next_far; // fall-back references
+
+  // Each clause gets only one far reference per table.
+  //
+  std::unordered_map<const char *, unsigned> far_refs, next_far_refs;
+
+  bool collecting; // between 'prepare' and 'swap'
+
+  unsigned reference (const char *start, unsigned page, const char *p) {
+    if (page == invalid_page)
+      return far_reference (p);
+    const size_t offset = p - start;
+    assert (!(offset & 7));
+    page += (unsigned) (offset / page_bytes);
+    const unsigned word = (unsigned) ((offset % page_bytes) >> 3);
+    return (page << (word_bits + 2)) | (word << 2);
+  }
+  unsigned far_reference (const char *);
+
+#endif
 
 public:
   Arena (Internal *);
@@ -67,22 +172,24 @@ public:
 
   // Prepare 'to' space to hold that amount of memory.  Precondition is that
   // the 'to' space is empty.  The following sequence of 'copy' operations
-  // can use as much memory in sum as pre-allocated here.
+  // can use as much memory in sum as pre-allocated here.  For a 'minor'
+  // collection the 'to' space is later kept with 'promote' instead of
+  // replacing everything else with 'swap'.
   //
-  void prepare (size_t bytes);
+  void prepare (size_t bytes, bool minor = false);
 
-  // Does the memory pointed to by 'p' belong to this arena? More precisely
-  // to the 'from' space, since that is the only one remaining after 'swap'.
+  // Does the memory pointed to by 'p' belong to a mature block of this
+  // arena, i.e., was it copied to the 'to' space by an earlier collection?
   //
-  bool contains (void *p) const {
-    char *c = (char *) p;
-    return from.start <= c && c < from.top;
+  bool contains (const void *p) const {
+    const Block *b = find_block ((const char *) p);
+    return b && !b->young;
   }
 
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
   // space has been prepared to hold enough memory with 'prepare'.  Then
   // copy the memory pointed to by 'p' of size 'bytes'.  Note that it does
-  // not matter whether 'p' is in 'from' or allocated outside of the arena.
+  // not matter whether 'p' is in the arena or allocated outside of it.
   //
   char *copy (const char *p, size_t bytes) {
     char *res = to.top;
@@ -92,11 +199,73 @@ public:
     return res;
   }
 
-  // Completely delete 'from' space and then replace 'from' by 'to' (by
-  // pointer swapping).  Everything previously allocated (in 'from') and not
-  // explicitly copied to 'to' with 'copy' becomes invalid.
+  // Completely delete all other blocks and keep only 'to' space as mature
+  // block.  Everything previously allocated and not explicitly copied to
+  // 'to' with 'copy' becomes invalid.
   //
   void swap ();
+
+  // Delete only the nursery chunks and keep 'to' space as additional
+  // mature block after a minor collection.
+  //
+  void promote ();
+
+  // Memory of garbage clauses in mature blocks can only be reclaimed by the
+  // next major collection.  This statistics is used to schedule it.
+  //
+  void waste (size_t bytes) { wasted += bytes; }
+  size_t mature_bytes () const { return mature; }
+  size_t wasted_bytes () const { return wasted; }
+
+  // Bytes of blocks aligned and advised to be backed by huge pages.
+  //
+  size_t huge_bytes () const;
+
+  // Allocate memory for a new clause in the current nursery chunk.  This
+  // memory is only reclaimed during the next 'swap' or 'promote'.
+  //
+  char *allocate (size_t bytes) {
+    char *res = nursery.top;
+    if (bytes > (size_t) (nursery.end - res))
+      res = new_nursery_chunk (bytes);
+    nursery.top = res + bytes;
+    return res;
+  }
+
+  // Are there nursery chunks which need to be released by 'swap' or
+  // 'promote'?
+  //
+  bool nursing () const { return nursery.start; }
+
+  // Was the memory pointed to by 'p' allocated in this arena (mature block
+  // or nursery), thus is not allowed to be deleted individually?
+  //
+  bool owns (const void *p) const { return find_block ((const char *) p); }
+
+#ifdef COMPACTWATCHES
+
+  // Compute the 32-bit reference of arena memory (lower two bits clear).
+  //
+  unsigned reference (const void *p) {
+    const char *c = (const char *) p;
+    if (nursery.start <= c && c < nursery.top)
+      return reference (nursery.start, nursery.page, c);
+    const Block *b = find_block (c);
+    assert (b);
+    return reference (b->start, b->page, c);
+  }
+
+  // Map a reference back to a pointer ignoring the binary flag.
+  //
+  char *dereference (unsigned ref) const {
+    if (ref & 2)
+      return far[ref >> 2];
+    const char *page = pages[ref >> (word_bits + 2)];
+    return (char *) page + ((size_t) ((ref >> 2) & ((1u << word_bits) - 1))
+                            << 3);
+  }
+
+#endif
 };
 
 } // namespace CaDiCaL
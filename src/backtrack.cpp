@@ -152,6 +152,8 @@ void Internal::backtrack (int new_level) {
 
   control.resize (new_level + 1);
   level = new_level;
+  if (!level)
+    flush_tombstones (); // Keep root-level free of tombstones.
   if (tainted_literal) {
     assert (opts.ilb);
     if (!val (tainted_literal)) {
@@ -45,6 +45,7 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
   LOG (c, "attempting backward subsumption and strengthening with");
   size_t len = UINT_MAX;
   unsigned size = 0;
+  uint64_t signature = 0;
   int best = 0;
   bool satisfied = false;
   assert (mini_chain.empty ());
@@ -61,6 +62,7 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
     if (l < len)
       best = lit, len = l;
     mark (lit);
+    signature |= signature_bit (lit);
     size++;
   }
   if (satisfied) {
@@ -80,6 +82,22 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
         continue;
       if ((unsigned) d->size < size)
         continue;
+
+      // Use the signature of the unassigned literals of 'c' (see
+      // 'clause_signature' in 'subsume.cpp') to skip clauses 'd' which do
+      // not contain all of its variables.  Clearing the bits of the
+      // variables of 'd' only reads its literals sequentially, while the
+      // check below needs a value and a mark lookup for each literal.
+      //
+      uint64_t missing = signature;
+      for (const auto &lit : *d)
+        if (!(missing &= ~signature_bit (lit)))
+          break;
+      if (missing) {
+        stats.subfiltered++;
+        continue;
+      }
+
       int negated = 0;
       unsigned found = 0;
       for (const auto &lit : *d) {
@@ -178,8 +196,8 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
               lrat_chain.push_back (id);
             }
             clear_analyzed_literals ();
-            lrat_chain.push_back (d->id);
-            lrat_chain.push_back (c->id);
+            lrat_chain.push_back (d->id ());
+            lrat_chain.push_back (c->id ());
           }
           if (satisfied) {
             assert (lrat_chain.empty ());
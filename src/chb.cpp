@@ -0,0 +1,80 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Conflict history based branching (CHB) following Liang, Ganesh, Poupart
+// and Czarnecki [AAAI'16] as an alternative to EVSIDS in stable mode.  The
+// score 'Q' of a variable is an exponential moving average of rewards
+//
+//   Q = (1 - alpha) * Q + alpha * reward
+//   reward = 1 / (conflicts - last_conflict + 1)
+//
+// where 'last_conflict' is the last conflict in which the variable was
+// bumped.  Thus variables which are frequently involved in recent conflicts
+// get high scores.  The step size 'alpha' starts with 'opts.chbstep' (per
+// mille) and is decreased by '1e-6' per conflict down to 'opts.chbstepmin'.
+
+// In contrast to the original proposal, rewards are only given to the
+// variables bumped during conflict analysis (and not to all variables
+// assigned during propagation) and thus the existing bump path and the
+// score heap are reused.  While CHB is active 'stab' contains the CHB
+// scores and the EVSIDS scores are saved in 'xtab' (and vice versa).
+
+// With 'opts.chb=1' all stable phases use CHB scores.  With 'opts.chb=2'
+// EVSIDS is used in odd and CHB in even stable phases.  The heuristic is
+// selected in 'stabilizing' when entering a stable phase.
+
+void Internal::bump_variable_chb (int lit) {
+  assert (chb);
+  const int idx = vidx (lit);
+  const int64_t last = ctab[idx];
+  assert (last <= stats.conflicts);
+  const double reward = 1.0 / (stats.conflicts - last + 1);
+  double &q = stab[idx];
+  q = (1 - chb_step) * q + chb_step * reward;
+  ctab[idx] = stats.conflicts;
+  stats.chb.bumped++;
+  LOG ("new CHB score %g of %d", q, idx);
+  if (scores.contains (idx))
+    scores.update (idx);
+}
+
+void Internal::update_chb_step () {
+  assert (chb);
+  const double min_step = opts.chbstepmin * 1e-3;
+  if (chb_step > min_step)
+    chb_step -= 1e-6;
+  if (chb_step < min_step)
+    chb_step = min_step;
+}
+
+// Swap CHB and EVSIDS scores in 'stab' and 'xtab' if the heuristic for the
+// new stable phase differs from the current one and rebuild the heap.
+
+void Internal::select_scores () {
+  assert (stable);
+  const bool use_chb =
+      opts.chb == 1 || (opts.chb == 2 && !(stats.stabphases & 1));
+  if (use_chb == chb)
+    return;
+  if (xtab.empty ()) {
+    xtab.resize (vsize, 0);
+    ctab.resize (vsize, 0);
+    chb_step = opts.chbstep * 1e-3;
+  }
+  PHASE ("stabilizing", stats.stabphases, "switching to %s scores",
+         use_chb ? "CHB" : "EVSIDS");
+  swap (stab, xtab);
+  chb = use_chb;
+  if (chb)
+    stats.chb.phases++;
+  vector<int> contained;
+  while (!scores.empty ())
+    contained.push_back (scores.pop_front ());
+  for (const auto &idx : contained)
+    scores.push_back (idx);
+}
+
+} // namespace CaDiCaL
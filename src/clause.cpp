@@ -81,22 +81,39 @@ Clause *Internal::new_clause (bool red, int glue) {
 
   if (glue > size)
     glue = size;
+  if (glue > Clause::max_glue)
+    glue = Clause::max_glue;
 
   // Determine whether this clauses should be kept all the time.
   //
   bool keep;
   if (!red)
     keep = true;
-  else if (glue <= opts.reducetier1glue)
+  else if (glue <= lim.tier1glue)
     keep = true;
   else
     keep = false;
 
-  size_t bytes = Clause::bytes (size);
-  Clause *c = (Clause *) new char[bytes];
+  // Identifiers are only stored if a proof is connected, which is only
+  // possible before the first clause is added (see 'Clause').
+  //
+  const bool identified = proof;
+  size_t bytes = Clause::bytes (size, identified);
+  char *p;
+#ifndef COMPACTWATCHES
+  if (!opts.arena || !opts.arenanursery)
+    p = new char[bytes];
+  else
+#endif
+    p = arena.allocate (bytes);
+  if (identified)
+    p += sizeof (uint64_t);
+  Clause *c = (Clause *) p;
 
-  c->id = ++clause_id;
+  c->identified = identified;
+  c->set_id (++clause_id);
 
+  c->buried = false;
   c->conditioned = false;
   c->covered = false;
   c->enqueued = false;
@@ -159,18 +176,18 @@ void Internal::promote_clause (Clause *c, int new_glue) {
   int old_glue = c->glue;
   if (new_glue >= old_glue)
     return;
-  if (!c->keep && new_glue <= opts.reducetier1glue) {
+  if (!c->keep && new_glue <= lim.tier1glue) {
     LOG (c, "promoting with new glue %d to tier1", new_glue);
     stats.promoted1++;
     c->keep = true;
-  } else if (old_glue > opts.reducetier2glue &&
-             new_glue <= opts.reducetier2glue) {
+  } else if (old_glue > lim.tier2glue &&
+             new_glue <= lim.tier2glue) {
     LOG (c, "promoting with new glue %d to tier2", new_glue);
     stats.promoted2++;
     c->used = 2;
   } else if (c->keep)
     LOG (c, "keeping with new glue %d in tier1", new_glue);
-  else if (old_glue <= opts.reducetier2glue)
+  else if (old_glue <= lim.tier2glue)
     LOG (c, "keeping with new glue %d in tier2", new_glue);
   else
     LOG (c, "keeping with new glue %d in tier3", new_glue);
@@ -207,7 +224,7 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
   size_t res = old_bytes - new_bytes;
 
   if (c->redundant)
-    promote_clause (c, min (c->size - 1, c->glue));
+    promote_clause (c, min (c->size - 1, (int) c->glue));
   else {
     int delta_size = old_size - new_size;
     assert (stats.irrlits >= delta_size);
@@ -221,12 +238,15 @@ size_t Internal::shrink_clause (Clause *c, int new_size) {
 }
 
 // This is the 'raw' deallocation of a clause.  If the clause is in the
-// arena nothing happens.  If the clause is not in the arena its memory is
-// reclaimed immediately.
+// arena (including its nursery) nothing happens, since that memory is only
+// released in bulk by the moving garbage collector.  The wasted memory of
+// clauses in mature arena blocks is accounted for when they are collected
+// (see 'copy_young_clauses' and 'delete_garbage_clauses').  If the clause
+// is not in the arena its memory is reclaimed immediately.
 
 void Internal::deallocate_clause (Clause *c) {
-  char *p = (char *) c;
-  if (arena.contains (p))
+  char *p = c->start ();
+  if (arena.owns (p))
     return;
   LOG (c, "deallocate pointer %p", (void *) c);
   delete[] p;
@@ -306,6 +326,12 @@ void Internal::mark_garbage (Clause *c) {
   c->garbage = true;
   c->used = 0;
 
+  // Garbage clauses in mature arena blocks are remembered for the next
+  // minor collection, which then does not have to search for them.
+  //
+  if (arena.contains (c))
+    mature_garbage.push_back (c);
+
   LOG (c, "marked garbage pointer %p", (void *) c);
 }
 
@@ -474,7 +500,7 @@ void Internal::add_new_original_clause (uint64_t id) {
       int glue = (int) (learned_levels.size () + unassigned);
       assert (glue <= (int) clause.size ());
       Clause *c = new_clause (false, glue);
-      c->id = new_id;
+      c->set_id (new_id);
       clause_id--;
       watch_clause (c);
       clause.clear ();
@@ -535,13 +561,16 @@ Clause *Internal::new_hyper_ternary_resolved_clause (bool red) {
 }
 
 // Add a new clause with same glue and redundancy as 'orig' but literals are
-// assumed to be in 'clause' in 'decompose' and 'vivify'.
+// assumed to be in 'clause' in 'decompose' and 'vivify'.  Since the tier
+// boundaries are adapted (see 'recompute_tiers') the glue of a kept clause
+// might exceed the current 'lim.tier1glue' and thus 'keep' is inherited.
 //
 Clause *Internal::new_clause_as (const Clause *orig) {
   external->check_learned_clause ();
   const int new_glue = orig->glue;
   Clause *res = new_clause (orig->redundant, new_glue);
-  assert (!orig->redundant || !orig->keep || res->keep);
+  if (orig->redundant && orig->keep)
+    res->keep = true;
   if (proof) {
     proof->add_derived_clause (res, lrat_chain);
   }
@@ -22,16 +22,17 @@ typedef const int *const_literal_iterator;
 // memory but more importantly also requires another memory access and thus
 // is very costly.
 
+// The header itself is kept small, since with many short clauses it
+// dominates memory usage.  The 64-bit clause identifier, which is only
+// needed for proof tracing and checking, is not stored in the header but
+// in front of it and only if the clause was allocated while a proof was
+// connected (which is only possible in the 'CONFIGURING' state and thus
+// either holds for all clauses or none).  Otherwise the flags, the glue,
+// the size and the Gent position need 12 bytes and a ternary clause fits
+// into 24 bytes (instead of 40 bytes with an inline identifier).
+
 struct Clause {
-  union {
-    uint64_t id;  // Used to create LRAT-style proofs
-    Clause *copy; // Only valid if 'moved', then that's where to.
-    //
-    // The 'copy' field is only valid for 'moved' clauses in the moving
-    // garbage collector 'copy_non_garbage_clauses' for keeping clauses
-    // compactly in a contiguous memory arena.  Otherwise, so almost all of
-    // the time, 'id' is valid.  See 'collect.cpp' for details.
-  };
+  bool buried : 1;      // has tombstone watches (see 'bury_watch')
   bool conditioned : 1; // Tried for globally blocked clause elimination.
   bool covered : 1;  // Already considered for covered clause elimination.
   bool enqueued : 1; // Enqueued on backward queue.
@@ -49,6 +50,7 @@ struct Clause {
   unsigned used : 2; // resolved in conflict analysis since last 'reduce'
   bool vivified : 1; // clause already vivified
   bool vivify : 1;   // clause scheduled to be vivified
+  bool identified : 1; // identifier stored in front of header (see 'id')
 
   // The glucose level ('LBD' or short 'glue') is a heuristic value for the
   // expected usefulness of a learned clause, where smaller glue is consider
@@ -70,10 +72,12 @@ struct Clause {
   // level tiers during conflict analysis.  The idea of using three tiers is
   // also due to Chanseok Oh and thus used in all recent 'Maple...' solvers.
   // Tier one are the always kept clauses with low glue at most
-  // 'opts.reducetier1glue' (default '2'). The second tier contains all
-  // clauses with glue larger than 'opts.reducetier1glue' but smaller or
-  // equal than 'opts.reducetier2glue' (default '6').  The third tier
-  // consists of clauses with glue larger than 'opts.reducetier2glue'.
+  // 'lim.tier1glue' (default '2'). The second tier contains all clauses
+  // with glue larger than 'lim.tier1glue' but smaller or equal than
+  // 'lim.tier2glue' (default '6').  The third tier consists of clauses
+  // with glue larger than 'lim.tier2glue'.  These boundaries start with
+  // 'opts.reducetier1glue' and 'opts.reducetier2glue' and are adapted to
+  // the glue of used clauses in 'recompute_tiers' (see 'reduce.cpp').
   //
   // Clauses in tier one are not deleted in 'reduce'. Clauses in tier
   // two require to be unused in two consecutive 'reduce' intervals before
@@ -84,7 +88,12 @@ struct Clause {
   // See 'mark_useless_redundant_clauses_as_garbage' in 'reduce.cpp' and
   // 'bump_clause' in 'analyze.cpp'.
   //
-  int glue;
+  // The glue is packed together with the flags above into one word and
+  // saturates at 'max_glue', which is far above any useful tier limit.
+  //
+  unsigned glue : 12;
+
+  static const int max_glue = (1 << 12) - 1;
 
   int size; // Actual size of 'literals' (at least 2).
   int pos;  // Position of last watch replacement [Gent'13].
@@ -99,8 +108,9 @@ struct Clause {
   // the 'copy' field above, as having a flexible array member inside a
   // union is not allowed.  Now compilers start to figure out that those
   // literals can be accessed with indices larger than 1 and produce
-  // warnings.  After having the 'id' field mandatory we now overlay that
-  // one with the copy field.
+  // warnings.  The 'copy' pointer of moved clauses is now again stored in
+  // place of the first two literals, but only accessed through 'memcpy'
+  // (see 'copy' and 'set_copy' below).
 
   // However, it turns out that even though flexible array members are in
   // C99 they are not in C11++, and therefore pedantic compilation with
@@ -124,13 +134,14 @@ struct Clause {
   const_literal_iterator begin () const { return literals; }
   const_literal_iterator end () const { return literals + size; }
 
-  static size_t bytes (int size) {
+  static size_t bytes (int size, bool identified) {
 
     // Memory sanitizer insists that clauses put into consecutive memory in
     // the arena are still 8 byte aligned.  We could also allocate 8 byte
     // aligned memory there.  However, assuming the real memory foot print
     // of a clause is 8 bytes anyhow, we just allocate 8 byte aligned memory
-    // all the time (even if allocated outside of the arena).
+    // all the time (even if allocated outside of the arena).  The optional
+    // identifier in front of the header keeps this alignment.
     //
     assert (size > 1);
     const size_t header_bytes = sizeof (Clause);
@@ -141,10 +152,51 @@ struct Clause {
     combined_bytes -= faked_literals_bytes;
 #endif
     size_t aligned_bytes = align (combined_bytes, 8);
+    if (identified)
+      aligned_bytes += sizeof (uint64_t);
     return aligned_bytes;
   }
 
-  size_t bytes () const { return bytes (size); }
+  size_t bytes () const { return bytes (size, identified); }
+
+  // Start of the allocated memory of the clause, which differs from the
+  // clause pointer if an identifier is stored in front of the header.
+  //
+  char *start () const {
+    char *res = (char *) this;
+    if (identified)
+      res -= sizeof (uint64_t);
+    return res;
+  }
+
+  // Used to create LRAT-style proofs.  Clauses without proof have no
+  // identifier and then zero is returned and setting it has no effect.
+  //
+  uint64_t id () const {
+    uint64_t res = 0;
+    if (identified)
+      memcpy (&res, start (), sizeof res);
+    return res;
+  }
+
+  void set_id (uint64_t id) {
+    if (identified)
+      memcpy (start (), &id, sizeof id);
+  }
+
+  // The 'copy' is only valid if 'moved', then that's where to.  It is only
+  // used in the moving garbage collector 'copy_non_garbage_clauses' for
+  // keeping clauses compactly in a contiguous memory arena and overwrites
+  // the first two literals, which are not needed anymore at that point.
+  // See 'collect.cpp' for details.
+  //
+  Clause *copy () const {
+    Clause *res;
+    memcpy (&res, literals, sizeof res);
+    return res;
+  }
+
+  void set_copy (Clause *c) { memcpy (literals, &c, sizeof c); }
 
   // Check whether this clause is ready to be collected and deleted.  The
   // 'reason' flag is only there to protect reason clauses in 'reduce',
@@ -175,7 +175,7 @@ size_t Internal::flush_occs (int lit) {
     c = *i;
     if (c->collect ())
       continue;
-    *j++ = c->moved ? c->copy : c;
+    *j++ = c->moved ? c->copy () : c;
     assert (!c->redundant);
     res++;
   }
@@ -198,12 +198,12 @@ inline void Internal::flush_watches (int lit, Watches &saved) {
   const_watch_iterator i;
   for (i = j; i != end; i++) {
     Watch w = *i;
-    Clause *c = w.clause;
+    Clause *c = watched_clause (w);
     if (c->collect ())
       continue;
     if (c->moved)
-      c = w.clause = c->copy;
-    w.size = c->size;
+      c = c->copy ();
+    update_watch (w, c);
     const int new_blit_pos = (c->literals[0] == lit);
     LOG (c, "clause in flush_watch starting from %d", lit);
     assert (c->literals[!new_blit_pos] == lit); /*FW1*/
@@ -248,10 +248,11 @@ void Internal::update_reason_references () {
       continue;
     if (c == external_reason)
       continue;
-    LOG (c, "updating assigned %d reason", lit);
     assert (c->reason);
-    assert (c->moved);
-    Clause *d = c->copy;
+    if (!c->moved) // mature clause in minor collection
+      continue;
+    LOG (c, "updating assigned %d reason", lit);
+    Clause *d = c->copy ();
     v.reason = d;
 #ifdef LOGGING
     count++;
@@ -270,22 +271,40 @@ void Internal::update_reason_references () {
 void Internal::delete_garbage_clauses () {
 
   flush_all_occs_and_watches ();
+  update_learned_index ();
+  clear_saved_trail ();
 
   LOG ("deleting garbage clauses");
 #ifndef QUIET
   int64_t collected_bytes = 0, collected_clauses = 0;
 #endif
-  const auto end = clauses.end ();
-  auto j = clauses.begin (), i = j;
+  // Memory of mature garbage clauses collected by earlier minor collections
+  // is already accounted as wasted but not of those collected now.  Then
+  // keep the mature prefix of 'clauses' and the remaining (reason) mature
+  // garbage clauses for the next minor collection.
+  //
+  for (const auto &c : mature_garbage)
+    if (c->collect ())
+      arena.waste (c->bytes ());
+  mature_garbage.clear ();
+  const auto begin = clauses.begin (), end = clauses.end ();
+  const auto mature_end = begin + mature_clauses;
+  auto j = begin, i = j;
   while (i != end) {
+    const bool mature = i < mature_end;
     Clause *c = *j++ = *i++;
-    if (!c->collect ())
+    if (!c->collect ()) {
+      if (mature && c->garbage)
+        mature_garbage.push_back (c);
       continue;
+    }
 #ifndef QUIET
     collected_bytes += c->bytes ();
     collected_clauses++;
 #endif
     delete_clause (c);
+    if (mature)
+      mature_clauses--;
     j--;
   }
   clauses.resize (j - clauses.begin ());
@@ -306,12 +325,13 @@ void Internal::delete_garbage_clauses () {
 void Internal::copy_clause (Clause *c) {
   LOG (c, "moving");
   assert (!c->moved);
-  char *p = (char *) c;
+  char *p = c->start ();
   char *q = arena.copy (p, c->bytes ());
-  c->copy = (Clause *) q;
+  Clause *d = (Clause *) (q + ((char *) c - p));
+  LOG ("copied clause[%" PRId64 "] from %p to %p", c->id (), (void *) c,
+       (void *) d);
+  c->set_copy (d);
   c->moved = true;
-  LOG ("copied clause[%" PRId64 "] from %p to %p", c->id, (void *) c,
-       (void *) c->copy);
 }
 
 // This is the moving garbage collector.
@@ -373,9 +393,11 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (auto idx : vars)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        for (const auto &w : watches (sign * likely_phase (idx))) {
+          Clause *c = watched_clause (w);
+          if (!c->moved && !c->collect ())
+            copy_clause (c);
+        }
 
   } else {
 
@@ -389,9 +411,11 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = queue.last; idx; idx = link (idx).prev)
-        for (const auto &w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        for (const auto &w : watches (sign * likely_phase (idx))) {
+          Clause *c = watched_clause (w);
+          if (!c->moved && !c->collect ())
+            copy_clause (c);
+        }
   }
 
   // Do not forget to move clauses which are not watched, which happened in
@@ -403,17 +427,26 @@ void Internal::copy_non_garbage_clauses () {
 
   flush_all_occs_and_watches ();
   update_reason_references ();
+  update_learned_index ();
+  clear_saved_trail ();
 
   // Replace and flush clause references in 'clauses'.
   //
+  mature_garbage.clear ();
   const auto end = clauses.end ();
   auto j = clauses.begin (), i = j;
   for (; i != end; i++) {
     Clause *c = *i;
     if (c->collect ())
       delete_clause (c);
-    else
-      assert (c->moved), *j++ = c->copy, deallocate_clause (c);
+    else {
+      assert (c->moved);
+      Clause *d = c->copy ();
+      if (c->garbage)
+        mature_garbage.push_back (d);
+      *j++ = d;
+      deallocate_clause (c);
+    }
   }
   clauses.resize (j - clauses.begin ());
   if (clauses.size () < clauses.capacity () / 2)
@@ -426,6 +459,11 @@ void Internal::copy_non_garbage_clauses () {
   //
   arena.swap ();
 
+  // Now all clauses are in the single mature block including garbage
+  // reason clauses, which are collected by the next collection instead.
+  //
+  mature_clauses = clauses.size ();
+
   PHASE ("collect", stats.collections,
          "collected %zd bytes %.0f%% of %zd garbage clauses",
          collected_bytes,
@@ -435,6 +473,146 @@ void Internal::copy_non_garbage_clauses () {
 
 /*------------------------------------------------------------------------*/
 
+// This is the minor (generational) garbage collector.  Clauses in mature
+// blocks of the arena are neither moved nor touched (and their memory is
+// not reclaimed) unless they became garbage.  Only young clauses surviving
+// are copied to a new mature block and only the watch lists of the two
+// watched literals of moved and collected clauses have to be flushed.  On
+// large formulas this avoids copying all clauses and going over all watch
+// lists after each 'reduce'.
+
+// Clauses are only appended to 'clauses' between collections, thus the
+// young clauses are exactly those after the mature prefix of length
+// 'mature_clauses'.  Mature clauses which became garbage are remembered in
+// 'mature_garbage' by 'mark_garbage'.  Thus neither the headers of the
+// other mature clauses nor their references in 'clauses' are touched.  As
+// a consequence collected mature garbage clauses are only removed from
+// the watch lists and their memory is accounted for as wasted.  They stay
+// in the mature prefix of 'clauses' (still being garbage) and are deleted
+// by the next major collection, which also reclaims their memory.
+
+void Internal::copy_young_clauses () {
+
+  assert (watching ());
+  assert (!occurring ());
+  assert (mature_clauses <= clauses.size ());
+
+#ifndef NDEBUG
+  // Only watch lists of moved and collected clauses are flushed below and
+  // thus all other watches have to be up-to-date already.
+  //
+  for (auto idx : vars)
+    for (auto lit : {-idx, idx})
+      for (const auto &w : watches (lit)) {
+        Clause *c = watched_clause (w);
+        if (c->collect ())
+          continue;
+        assert (c->literals[0] == lit || c->literals[1] == lit);
+        assert (w.binary () == (c->size == 2));
+      }
+  for (size_t i = 0; i < clauses.size (); i++)
+    assert (arena.contains (clauses[i]) == (i < mature_clauses));
+  for (const auto &c : mature_garbage)
+    assert (c->garbage), assert (arena.contains (c));
+#endif
+
+  size_t collected_clauses = 0, collected_bytes = 0;
+  size_t moved_clauses = 0, moved_bytes = 0;
+
+  // Determine young surviving clauses and the literals with watch lists
+  // which need to be flushed (before 'copy_clause' overwrites literals).
+  // Garbage mature clauses which can not be collected yet, since they are
+  // reasons, are kept for the next collection.
+  //
+  vector<Clause *> young;
+  vector<int> dirty;
+  const auto mark_dirty = [&] (Clause *c) {
+    for (int i = 0; i < 2; i++) {
+      const int lit = c->literals[i];
+      if (marked2 (lit))
+        continue;
+      mark2 (lit);
+      dirty.push_back (lit);
+    }
+  };
+  const auto begin = clauses.begin () + mature_clauses;
+  const auto end = clauses.end ();
+  for (auto i = begin; i != end; i++) {
+    Clause *c = *i;
+    if (c->collect ())
+      collected_bytes += c->bytes (), collected_clauses++;
+    else {
+      moved_bytes += c->bytes (), moved_clauses++;
+      young.push_back (c);
+    }
+    mark_dirty (c);
+  }
+  size_t kept = 0;
+  for (const auto &c : mature_garbage)
+    if (c->collect ()) {
+      const size_t bytes = c->bytes ();
+      collected_bytes += bytes, collected_clauses++;
+      arena.waste (bytes);
+      mark_dirty (c);
+    } else
+      mature_garbage[kept++] = c;
+  mature_garbage.resize (kept);
+
+  PHASE ("collect", stats.collections,
+         "minor collection moving %zd bytes of %zd young clauses",
+         moved_bytes, moved_clauses);
+
+  arena.prepare (moved_bytes, true);
+  for (const auto &c : young)
+    copy_clause (c);
+  erase_vector (young);
+
+  Watches tmp;
+  for (const auto &lit : dirty) {
+    unmark (lit);
+    flush_watches (lit, tmp);
+  }
+  PHASE ("collect", stats.collections,
+         "flushed %zd watch lists %.0f%% of all", dirty.size (),
+         percent (dirty.size (), 2 * (size_t) active ()));
+  erase_vector (dirty);
+
+  update_reason_references ();
+  update_learned_index ();
+  clear_saved_trail ();
+
+  // Only the young clauses at the end of 'clauses' are replaced.  Moved
+  // garbage reason clauses become mature garbage clauses.
+  //
+  auto j = begin;
+  for (auto i = begin; i != end; i++) {
+    Clause *c = *i;
+    if (c->collect ())
+      delete_clause (c);
+    else {
+      assert (c->moved);
+      Clause *d = c->copy ();
+      if (c->garbage)
+        mature_garbage.push_back (d);
+      *j++ = d;
+      deallocate_clause (c);
+    }
+  }
+  clauses.resize (j - clauses.begin ());
+  if (clauses.size () < clauses.capacity () / 2)
+    shrink_vector (clauses);
+  mature_clauses = clauses.size ();
+
+  arena.promote ();
+
+  PHASE ("collect", stats.collections,
+         "collected %zd bytes of %zd garbage clauses (%zd bytes wasted)",
+         collected_bytes, collected_clauses, arena.wasted_bytes ());
+  (void) moved_clauses, (void) collected_clauses, (void) collected_bytes;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Maintaining clause statistics is complex and error prone but necessary
 // for proper scheduling of garbage collection, particularly during bounded
 // variable elimination.  With this function we can check whether these
@@ -470,6 +648,7 @@ void Internal::remove_garbage_binaries () {
     return;
   START (collect);
 
+  flush_tombstones ();
   if (!protected_reasons)
     protect_reasons ();
   int backtrack_level = level + 1;
@@ -483,7 +662,7 @@ void Internal::remove_garbage_binaries () {
       const_watch_iterator i;
       for (i = j; i != end; i++) {
         Watch w = *i;
-        Clause *c = w.clause;
+        Clause *c = watched_clause (w);
         if (c->reason && c->collect ()) {
           assert (c->size == 2);
           backtrack_level =
@@ -493,7 +672,7 @@ void Internal::remove_garbage_binaries () {
         if (c->collect ())
           continue;
         assert (!c->moved);
-        w.size = c->size;
+        update_watch (w, c);
         const int new_blit_pos = (c->literals[0] == lit);
         LOG (c, "clause in flush_watch starting from %d", lit);
         assert (c->literals[!new_blit_pos] == lit); /*FW1*/
@@ -519,20 +698,59 @@ void Internal::remove_garbage_binaries () {
 
 /*------------------------------------------------------------------------*/
 
-bool Internal::arenaing () { return opts.arena && (stats.collections > 1); }
+// With compact watches clauses are only ever freed by moving them.  The
+// same applies to clauses allocated in the nursery of the arena.
+
+bool Internal::arenaing () {
+#ifdef COMPACTWATCHES
+  return true;
+#else
+  return arena.nursing () || (opts.arena && stats.collections > 1);
+#endif
+}
+
+// A minor collection is only possible without occurrence lists and if no
+// new units were found since the last major collection.  Otherwise clauses
+// (mature ones too) might have been shrunken in place by removing falsified
+// literals, which requires to flush all watches.  If too much memory in
+// mature blocks is wasted by garbage clauses a major collection is
+// performed too.
+
+bool Internal::minor_collection () {
+  if (!opts.arenaminor)
+    return false;
+  if (last.collect.major < stats.all.fixed)
+    return false;
+  if (!watching () || occurring ())
+    return false;
+  const size_t mature = arena.mature_bytes ();
+  if (!mature)
+    return false;
+  const double limit = mature * (opts.arenawaste / 100.0);
+  return arena.wasted_bytes () <= limit;
+}
+
+// Minor collections leave collected mature garbage clauses in 'clauses'.
+// If all garbage clauses have to be removed, as before renaming variables
+// in 'compact', a 'major' collection has to be enforced.
 
-void Internal::garbage_collection () {
+void Internal::garbage_collection (bool major) {
   if (unsat)
     return;
   START (collect);
   report ('G', 1);
   stats.collections++;
+  flush_tombstones ();
   mark_satisfied_clauses_as_garbage ();
   if (!protected_reasons)
     protect_reasons ();
-  if (arenaing ())
+  if (!major && arenaing () && minor_collection ()) {
+    stats.minorcollections++;
+    copy_young_clauses ();
+  } else if (arenaing ()) {
+    last.collect.major = stats.all.fixed;
     copy_non_garbage_clauses ();
-  else
+  } else
     delete_garbage_clauses ();
   check_clause_stats ();
   check_var_stats ();
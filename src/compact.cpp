@@ -103,7 +103,7 @@ struct Mapper {
   /*----------------------------------------------------------------------*/
   // Map positive variable indices in vector.
   //
-  template <class T> void map_vector (vector<T> &v) {
+  template <class T, class A> void map_vector (vector<T, A> &v) {
     for (auto src : internal->vars) {
       const int dst = map_idx (src);
       if (!dst)
@@ -119,7 +119,7 @@ struct Mapper {
   /*----------------------------------------------------------------------*/
   // Map positive and negative variable indices in two-sided vector.
   //
-  template <class T> void map2_vector (vector<T> &v) {
+  template <class T, class A> void map2_vector (vector<T, A> &v) {
     for (auto src : internal->vars) {
       const int dst = map_idx (src);
       if (!dst)
@@ -157,8 +157,6 @@ struct Mapper {
 
 /*------------------------------------------------------------------------*/
 
-static signed char *ignore_clang_analyze_memory_leak_warning;
-
 void Internal::compact () {
 
   START (compact);
@@ -177,7 +175,7 @@ void Internal::compact () {
   assert (control.size () == 1);
   assert (propagated == trail.size ());
 
-  garbage_collection ();
+  garbage_collection (true);
 
   Mapper mapper (this);
 
@@ -336,9 +334,12 @@ void Internal::compact () {
   // Now we continue in reverse order of allocated bytes, e.g., see
   // 'Internal::enlarge' which reallocates in order of allocated bytes.
 
+#ifndef PACKEDVARS
   mapper.map_vector (ftab);
+#endif
   mapper.map_vector (parents);
   mapper.map_vector (marks);
+  mapper.map_vector (saved_positions);
   mapper.map_vector (phases.saved);
   mapper.map_vector (phases.forced);
   mapper.map_vector (phases.target);
@@ -379,6 +380,26 @@ void Internal::compact () {
 
   /*----------------------------------------------------------------------*/
 
+  // Special case for 'val' as for 'val' we trade branch less code for
+  // memory and always allocated an [-maxvar,...,maxvar] array.
+  {
+    signed char *new_vals = allocate_vals (mapper.new_vsize);
+    for (auto src : vars)
+      new_vals[-mapper.map_idx (src)] = vals[-src];
+    for (auto src : vars)
+      new_vals[mapper.map_idx (src)] = vals[src];
+    new_vals[0] = 0;
+    deallocate_vals ();
+    vals = new_vals;
+  }
+
+  // Reassuming below reads values, levels and flags of the mapped
+  // variables, thus 'vals' and 'vtab' have to be mapped before.
+  //
+  mapper.map_vector (vtab);
+
+  /*----------------------------------------------------------------------*/
+
   if (!external->assumptions.empty ()) {
 
     for (const auto &elit : external->assumptions) {
@@ -397,22 +418,6 @@ void Internal::compact () {
            external->assumptions.size ());
   }
 
-  // Special case for 'val' as for 'val' we trade branch less code for
-  // memory and always allocated an [-maxvar,...,maxvar] array.
-  {
-    signed char *new_vals = new signed char[2 * mapper.new_vsize];
-    ignore_clang_analyze_memory_leak_warning = new_vals;
-    new_vals += mapper.new_vsize;
-    for (auto src : vars)
-      new_vals[-mapper.map_idx (src)] = vals[-src];
-    for (auto src : vars)
-      new_vals[mapper.map_idx (src)] = vals[src];
-    new_vals[0] = 0;
-    vals -= vsize;
-    delete[] vals;
-    vals = new_vals;
-  }
-
   // 'constrain' uses 'val', so this code has to be after remapping that
   if (is_constraint) {
     assert (!level);
@@ -439,7 +444,6 @@ void Internal::compact () {
   mapper.map_vector (btab);
   mapper.map_vector (gtab);
   mapper.map_vector (links);
-  mapper.map_vector (vtab);
   if (!ntab.empty ())
     mapper.map2_vector (ntab);
   if (!wtab.empty ())
@@ -475,6 +479,10 @@ void Internal::compact () {
     scores.erase ();
   }
   mapper.map_vector (stab);
+  if (!xtab.empty ()) {
+    mapper.map_vector (xtab);
+    mapper.map_vector (ctab);
+  }
   if (!saved.empty ()) {
     for (const auto idx : saved)
       scores.push_back (idx);
@@ -20,7 +20,7 @@ void Internal::decompose_analyze_binary_chain (DFS *dfs, int from) {
   if (!reason)
     return;
   assert (reason->size == 2);
-  mini_chain.push_back (reason->id);
+  mini_chain.push_back (reason->id ());
   int other = reason->literals[0];
   other = other == from ? -reason->literals[1] : -other;
   Flags &f = flags (other);
@@ -109,9 +109,9 @@ void Internal::build_lrat_for_clause (
       mark_decomposed (other);
       int implied = p->literals[0];
       implied = implied == other ? -p->literals[1] : -implied;
-      LOG ("ADDED %d -> %d (%" PRIu64 ")", implied, other, p->id);
+      LOG ("ADDED %d -> %d (%" PRIu64 ")", implied, other, p->id ());
       other = implied;
-      mini_chain.push_back (p->id);
+      mini_chain.push_back (p->id ());
       if (val (implied) <= 0)
         continue;
       if (marked_decompose (implied))
@@ -299,7 +299,7 @@ bool Internal::decompose_round () {
                     DFS &child_dfs = dfs[vlit (child)];
                     if (child_dfs.parent)
                       continue;
-                    child_dfs.parent = w.clause;
+                    child_dfs.parent = watched_clause (w);
                     todo.push_back (child);
                   }
                 }
@@ -592,7 +592,7 @@ bool Internal::decompose_round () {
       }
     }
     if (lrat)
-      lrat_chain.push_back (c->id);
+      lrat_chain.push_back (c->id ());
     clear_analyzed_literals ();
     LOG (lrat_chain, "lrat_chain:");
     if (satisfied) {
@@ -634,7 +634,7 @@ bool Internal::decompose_round () {
         proof->add_derived_clause (++clause_id, c->redundant, clause,
                                    lrat_chain);
         proof->delete_clause (c);
-        c->id = clause_id;
+        c->set_id (clause_id);
       }
       size_t l;
       int *literals = c->literals;
@@ -650,8 +650,14 @@ bool Internal::decompose_round () {
         mark_added (c);
       // we have assert (c->size > 2)
       if (c->size == 2) { // cheaper to update only new binary clauses
-        update_watch_size (watches (c->literals[0]), c->literals[1], c);
-        update_watch_size (watches (c->literals[1]), c->literals[0], c);
+        if (opts.tombstone) {
+          mark_tombstoned (c->literals[0]);
+          mark_tombstoned (c->literals[1]);
+          stats.tombstones.delayed++;
+        } else {
+          update_watch_size (watches (c->literals[0]), c->literals[1], c);
+          update_watch_size (watches (c->literals[1]), c->literals[0], c);
+        }
       }
       LOG (c, "substituted");
     }
@@ -664,6 +670,10 @@ bool Internal::decompose_round () {
     lrat_chain.clear ();
   }
 
+  // Update the watches of clauses which became binary in one go.
+
+  flush_tombstones ();
+
   if (proof) {
     for (auto idx : vars) {
       if (!active (idx))
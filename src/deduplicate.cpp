@@ -64,7 +64,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
           continue;
         int other = w.blit;
         const int tmp = marked (other);
-        Clause *c = w.clause;
+        Clause *c = watched_clause (w);
 
         if (tmp > 0) { // Found duplicated binary clause.
 
@@ -86,7 +86,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
                 continue;
               if (k->blit != other)
                 continue;
-              Clause *d = k->clause;
+              Clause *d = watched_clause (*k);
               if (d->garbage)
                 continue;
               c = d;
@@ -110,7 +110,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
           if (lrat) {
             // taken from fradical
             assert (lrat_chain.empty ());
-            lrat_chain.push_back (c->id);
+            lrat_chain.push_back (c->id ());
             // We've forgotten where the other binary clause is, so go find
             // it again
             for (watch_iterator k = ws.begin ();; k++) {
@@ -119,7 +119,7 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
                 continue;
               if (k->blit != -other)
                 continue;
-              lrat_chain.push_back (k->clause->id);
+              lrat_chain.push_back (watched_clause (*k)->id ());
               break;
             }
           }
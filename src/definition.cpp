@@ -0,0 +1,275 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Semantic definition extraction in the spirit of 'kitten' in Kissat.  The
+// syntactic gate detection in 'gates.cpp' only finds equivalences, AND
+// gates, if-then-else gates and small XOR gates.  Circuit encodings often
+// contain other definitions (multiplexers with shared inputs, majority
+// gates, etc.) which are encoded differently.  If no syntactic gate is
+// found, and 'opts.elimdefs' is enabled, we take all the clauses with
+// 'pivot' or '-pivot', remove the pivot and check the resulting small
+// formula for satisfiability with a tiny embedded DPLL solver.
+
+// If this formula is unsatisfiable then 'pivot' is defined in terms of the
+// other variables (Padoa's method) by the clauses in an unsatisfiable core
+// of the formula.  The core is determined by marking the clauses of the
+// implication graph at every conflict of the DPLL search tree, which form
+// a tree-like resolution refutation.  The core clauses are then used as
+// gate clauses for substitution, i.e., resolvents among non-gate clauses
+// are not generated.  In contrast to syntactic gates, resolvents among
+// gate clauses are not necessarily tautological and thus are still needed
+// (see 'skip' in 'elim.hpp').  The effort of the sub-solver is limited by
+// 'opts.elimdefticks' visited literals per attempt.
+
+struct Definer {
+
+  struct Level {
+    size_t trail;  // trail position of the decision
+    int decision;  // decision literal (or flipped decision)
+    bool flipped;  // decision has been flipped already
+  };
+
+  vector<int> literals;     // flat local literals of all clauses
+  vector<unsigned> starts;  // start of clause 'i' in 'literals'
+  vector<Clause *> origins; // original clause of clause 'i'
+  vector<signed char> vals; // local assignment indexed by variable
+  vector<int> reasons;      // local reasons indexed by variable
+  vector<bool> seen;        // analyzed variables
+  vector<bool> core;        // clauses in the core
+  vector<int> trail;
+  vector<Level> control;
+  vector<int> analyzed;
+  vector<unsigned> stack;
+  int64_t ticks, limit;
+
+  Definer (int64_t l) : ticks (0), limit (l) {}
+
+  unsigned clauses () const { return origins.size (); }
+  int variables () const { return (int) vals.size () - 1; }
+
+  signed char val (int lit) const {
+    const signed char tmp = vals[abs (lit)];
+    return lit < 0 ? -tmp : tmp;
+  }
+
+  void assign (int lit, int reason) {
+    const int idx = abs (lit);
+    assert (!vals[idx]);
+    vals[idx] = lit < 0 ? -1 : 1;
+    reasons[idx] = reason;
+    trail.push_back (lit);
+  }
+
+  void unassign (size_t new_trail_size) {
+    while (trail.size () > new_trail_size) {
+      const int idx = abs (trail.back ());
+      trail.pop_back ();
+      vals[idx] = 0;
+      reasons[idx] = -1;
+    }
+  }
+
+  // Naive propagation until fix-point.  Returns a falsified clause or -1.
+
+  int propagate () {
+    bool changed;
+    do {
+      changed = false;
+      for (unsigned i = 0; i < clauses (); i++) {
+        const int *const begin = literals.data () + starts[i];
+        const int *const end = literals.data () + starts[i + 1];
+        ticks += end - begin;
+        int unit = 0, unassigned = 0;
+        bool satisfied = false;
+        for (const int *p = begin; !satisfied && p != end; p++) {
+          const signed char tmp = val (*p);
+          if (tmp > 0)
+            satisfied = true;
+          else if (!tmp)
+            unit = *p, unassigned++;
+        }
+        if (satisfied || unassigned > 1)
+          continue;
+        if (!unassigned)
+          return i;
+        assign (unit, i);
+        changed = true;
+      }
+    } while (changed && ticks <= limit);
+    return -1;
+  }
+
+  // Mark all clauses in the implication graph of the conflict as core.
+
+  void analyze (unsigned conflict) {
+    assert (stack.empty ());
+    stack.push_back (conflict);
+    while (!stack.empty ()) {
+      const unsigned i = stack.back ();
+      stack.pop_back ();
+      core[i] = true;
+      for (unsigned j = starts[i]; j != starts[i + 1]; j++) {
+        const int idx = abs (literals[j]);
+        if (seen[idx])
+          continue;
+        seen[idx] = true;
+        analyzed.push_back (idx);
+        if (reasons[idx] >= 0)
+          stack.push_back (reasons[idx]);
+      }
+    }
+    for (const auto &idx : analyzed)
+      seen[idx] = false;
+    analyzed.clear ();
+  }
+
+  // Returns '20' if unsatisfiable, '10' if satisfiable and zero if the
+  // limit was hit.
+
+  int solve () {
+    core.resize (clauses (), false);
+    for (;;) {
+      const int conflict = propagate ();
+      if (ticks > limit)
+        return 0;
+      if (conflict >= 0) {
+        analyze (conflict);
+        while (!control.empty () && control.back ().flipped) {
+          unassign (control.back ().trail);
+          control.pop_back ();
+        }
+        if (control.empty ())
+          return 20;
+        Level &l = control.back ();
+        unassign (l.trail);
+        l.decision = -l.decision;
+        l.flipped = true;
+        assign (l.decision, -1);
+        continue;
+      }
+      int decision = 0;
+      for (int idx = 1; !decision && idx <= variables (); idx++)
+        if (!vals[idx])
+          decision = -idx;
+      if (!decision)
+        return 10;
+      control.push_back (Level{trail.size (), decision, false});
+      assign (decision, -1);
+    }
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+void Internal::find_definition (Eliminator &eliminator, int pivot) {
+
+  if (!opts.elimdefs)
+    return;
+
+  assert (opts.elimsubst);
+
+  if (unsat)
+    return;
+  if (val (pivot))
+    return;
+  if (!eliminator.gates.empty ())
+    return;
+
+  // Copy the non-false literals of the non-satisfied clauses with 'pivot'
+  // and '-pivot' (but without these) and map variables to '1,...,n'.
+
+  Definer definer (opts.elimdefticks);
+  unsigned positives = 0;
+  for (const auto sign : {1, -1}) {
+    if (sign < 0)
+      positives = definer.clauses ();
+    for (const auto &c : occs (sign * pivot)) {
+      if (c->garbage)
+        continue;
+      const size_t start = definer.literals.size ();
+      bool satisfied = false;
+      for (const auto &lit : *c) {
+        if (lit == sign * pivot)
+          continue;
+        const signed char tmp = val (lit);
+        if (tmp > 0) {
+          satisfied = true;
+          break;
+        }
+        if (tmp < 0)
+          continue;
+        definer.literals.push_back (lit);
+      }
+      if (satisfied) {
+        definer.literals.resize (start);
+        continue;
+      }
+      if (definer.literals.size () == start) {
+        LOG (c, "definition candidate reduced to unit");
+        return;
+      }
+      definer.starts.push_back (start);
+      definer.origins.push_back (c);
+    }
+  }
+  definer.starts.push_back (definer.literals.size ());
+
+  vector<int> vars;
+  for (const auto &lit : definer.literals)
+    vars.push_back (abs (lit));
+  sort (vars.begin (), vars.end ());
+  vars.resize (unique (vars.begin (), vars.end ()) - vars.begin ());
+  for (auto &lit : definer.literals) {
+    const auto it = lower_bound (vars.begin (), vars.end (), abs (lit));
+    const int idx = 1 + (int) (it - vars.begin ());
+    lit = lit < 0 ? -idx : idx;
+  }
+  const size_t size = vars.size () + 1;
+  definer.vals.resize (size, 0);
+  definer.reasons.resize (size, -1);
+  definer.seen.resize (size, false);
+
+  LOG ("trying to find definition of %d with %u clauses over %zd variables",
+       pivot, definer.clauses (), vars.size ());
+
+  const int res = definer.solve ();
+  stats.elimdefticks += definer.ticks;
+  if (res != 20) {
+    LOG ("no definition for %d found (%s)", pivot,
+         res ? "satisfiable" : "limit hit");
+    return;
+  }
+
+  // Both the positive and the negative occurrences need to contribute to
+  // the core.  Otherwise the pivot is actually implied, which we leave for
+  // other procedures (such as failed literal probing) to find.
+
+  bool positive = false, negative = false;
+  for (unsigned i = 0; i < definer.clauses (); i++)
+    if (definer.core[i])
+      (i < positives ? positive : negative) = true;
+  if (!positive || !negative) {
+    LOG ("core for %d only on one side", pivot);
+    return;
+  }
+
+  for (unsigned i = 0; i < definer.clauses (); i++) {
+    if (!definer.core[i])
+      continue;
+    Clause *c = definer.origins[i];
+    assert (!c->gate);
+    LOG (c, "definition");
+    c->gate = true;
+    eliminator.gates.push_back (c);
+  }
+  eliminator.definition = true;
+  stats.elimgates++;
+  stats.elimdefs++;
+  LOG ("found definition of %d with %zd out of %u clauses", pivot,
+       eliminator.gates.size (), definer.clauses ());
+}
+
+} // namespace CaDiCaL
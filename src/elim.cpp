@@ -367,8 +367,8 @@ bool Internal::resolve_clauses (Eliminator &eliminator, Clause *c,
   const int64_t size = clause.size ();
 
   if (lrat) {
-    lrat_chain.push_back (d->id);
-    lrat_chain.push_back (c->id);
+    lrat_chain.push_back (d->id ());
+    lrat_chain.push_back (c->id ());
   }
 
   if (satisfied) {
@@ -470,6 +470,12 @@ bool Internal::resolve_clauses (Eliminator &eliminator, Clause *c,
 // (smallest clauses first) and also negates pivot if it has more positive
 // than negative occurrences.
 
+// The non-tautological resolvents are saved in 'eliminator.resolvents',
+// such that 'elim_add_resolvents' only has to add them instead of
+// resolving all pairs of clauses again.  This is only valid if resolving
+// did not have any side effect (no clause became garbage and no unit was
+// found) and without LRAT, since then each resolvent needs its chain.
+
 bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
                                             int pivot) {
   const bool substitute = !eliminator.gates.empty ();
@@ -481,6 +487,9 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
   assert (!unsat);
   assert (active (pivot));
 
+  vector<int> &saved = eliminator.resolvents;
+  saved.clear ();
+
   const Occs &ps = occs (pivot);
   const Occs &ns = occs (-pivot);
   const int64_t pos = ps.size ();
@@ -500,6 +509,10 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
 
   int64_t resolvents = 0; // Non-tautological resolvents.
 
+  const int64_t garbage_before = stats.garbage.clauses;
+  const size_t trail_before = trail.size ();
+  bool save = !lrat;
+
   for (const auto &c : ps) {
     assert (!c->redundant);
     if (c->garbage)
@@ -508,12 +521,17 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
       assert (!d->redundant);
       if (d->garbage)
         continue;
-      if (substitute && c->gate == d->gate)
+      if (eliminator.skip (c, d))
         continue;
       stats.elimrestried++;
       if (resolve_clauses (eliminator, c, pivot, d, true)) {
         resolvents++;
         int size = clause.size ();
+        if (save) {
+          for (const auto &lit : clause)
+            saved.push_back (lit);
+          saved.push_back (0);
+        }
         clause.clear ();
         LOG ("now at least %" PRId64
              " non-tautological resolvents on pivot %d",
@@ -538,6 +556,16 @@ bool Internal::elim_resolvents_are_bounded (Eliminator &eliminator,
   LOG ("need %" PRId64 " <= %" PRId64 " non-tautological resolvents",
        resolvents, bound);
 
+  if (save && (stats.garbage.clauses != garbage_before ||
+               trail.size () != trail_before)) {
+    LOG ("resolving had side effects thus not saving resolvents");
+    save = false;
+  }
+  if (!save)
+    saved.clear ();
+  else if (saved.empty ())
+    saved.push_back (0); // Mark empty set of resolvents as saved.
+
   return true;
 }
 
@@ -564,6 +592,31 @@ inline void Internal::elim_add_resolvents (Eliminator &eliminator,
 #ifdef LOGGING
   int64_t resolvents = 0;
 #endif
+  vector<int> &saved = eliminator.resolvents;
+  if (!saved.empty ()) {
+    LOG ("adding saved resolvents");
+    assert (clause.empty ());
+    assert (lrat_chain.empty ());
+    for (const auto &lit : saved) {
+      if (lit) {
+        clause.push_back (lit);
+        continue;
+      }
+      if (clause.empty ())
+        continue;
+      Clause *r = new_resolved_irredundant_clause ();
+      elim_update_added_clause (eliminator, r);
+      eliminator.enqueue (r);
+      stats.elimresreused++;
+      clause.clear ();
+#ifdef LOGGING
+      resolvents++;
+#endif
+    }
+    saved.clear ();
+    LOG ("added %" PRId64 " resolvents to eliminate %d", resolvents, pivot);
+    return;
+  }
   for (auto &c : ps) {
     if (unsat)
       break;
@@ -574,7 +627,7 @@ inline void Internal::elim_add_resolvents (Eliminator &eliminator,
         break;
       if (d->garbage)
         continue;
-      if (substitute && c->gate == d->gate)
+      if (eliminator.skip (c, d))
         continue;
       if (!resolve_clauses (eliminator, c, pivot, d, false))
         continue;
@@ -20,7 +20,8 @@ struct Eliminator {
   Internal *internal;
   ElimSchedule schedule;
 
-  Eliminator (Internal *i) : internal (i), schedule (elim_more (i)) {}
+  Eliminator (Internal *i)
+      : internal (i), schedule (elim_more (i)), definition (false) {}
   ~Eliminator ();
 
   queue<Clause *> backward;
@@ -30,6 +31,25 @@ struct Eliminator {
 
   vector<Clause *> gates;
   vector<int> marked;
+
+  // The gate clauses form a semantic definition (see 'definition.cpp').
+  //
+  bool definition;
+
+  // With gate clauses resolvents among non-gate clauses are not needed and
+  // neither are (tautological) resolvents among clauses of syntactic gates.
+  //
+  bool skip (Clause *c, Clause *d) const {
+    if (gates.empty ())
+      return false;
+    if (definition)
+      return !c->gate && !d->gate;
+    return c->gate == d->gate;
+  }
+
+  // Zero terminated resolvents computed while checking the bound.
+  //
+  vector<int> resolvents;
 };
 
 } // namespace CaDiCaL
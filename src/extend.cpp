@@ -48,7 +48,12 @@ void External::push_clause_on_extension_stack (Clause *c) {
   internal->stats.weakened++;
   internal->stats.weakenedlen += c->size;
   push_zero_on_extension_stack ();
-  push_id_on_extension_stack (c->id);
+  // Clauses without proof do not store their identifier but the witness
+  // traversal still requires a unique non-zero one.
+  uint64_t id = c->id ();
+  if (!id)
+    id = ++internal->clause_id;
+  push_id_on_extension_stack (id);
   push_zero_on_extension_stack ();
   for (const auto &lit : *c)
     push_clause_literal_on_extension_stack (lit);
@@ -796,8 +796,6 @@ bool External::traverse_all_non_frozen_units_as_witnesses (
 /*------------------------------------------------------------------------*/
 
 void External::copy_flags (External &other) const {
-  const vector<Flags> &this_ftab = internal->ftab;
-  vector<Flags> &other_ftab = other.internal->ftab;
   const unsigned limit = min (max_var, other.max_var);
   for (unsigned eidx = 1; eidx <= limit; eidx++) {
     const int this_ilit = e2i[eidx];
@@ -812,8 +810,8 @@ void External::copy_flags (External &other) const {
       continue;
     assert (this_ilit != INT_MIN);
     assert (other_ilit != INT_MIN);
-    const Flags &this_flags = this_ftab[abs (this_ilit)];
-    Flags &other_flags = other_ftab[abs (other_ilit)];
+    const Flags &this_flags = internal->flags (this_ilit);
+    Flags &other_flags = other.internal->flags (other_ilit);
     this_flags.copy (other_flags);
   }
 }
@@ -31,6 +31,10 @@ struct Flags { // Variable flags.
   unsigned char block : 2; // removed since last 'block' round (*)
   unsigned char skip : 2;  // skip this literal as blocking literal
 
+  // Literal flag for watch lists with tombstones (see 'bury_watch').
+  //
+  unsigned char buried : 2;
+
   // Bits for handling assumptions.
   //
   unsigned char assumed : 2;
@@ -55,7 +59,7 @@ struct Flags { // Variable flags.
     seen = keep = poison = removable = shrinkable = added = false;
     subsume = elim = ternary = true;
     block = 3u;
-    skip = assumed = failed = decompose = 0;
+    skip = buried = assumed = failed = decompose = 0;
     status = UNUSED;
   }
 
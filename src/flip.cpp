@@ -10,8 +10,10 @@ bool Internal::flip (int lit) {
     return false;
 
   // Need to reestablish proper watching invariants as if there are no
-  // blocking literals as flipping in principle does not work with them.
+  // blocking literals as flipping in principle does not work with them
+  // (nor with tombstones).
 
+  flush_tombstones ();
   if (propergated < trail.size ())
     propergate ();
 
@@ -61,20 +63,22 @@ bool Internal::flip (int lit) {
       if (w.binary ())
         continue;
 
-      if (w.clause->garbage) {
+      Clause *c = watched_clause (w);
+
+      if (c->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = c->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
       if (u > 0)
         continue;
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = c->size;
+      const literal_iterator middle = lits + c->pos;
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -84,7 +88,7 @@ bool Internal::flip (int lit) {
         k++;
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (c->pos <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
@@ -95,10 +99,10 @@ bool Internal::flip (int lit) {
       }
 
       assert (v > 0);
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= c->end ());
+      c->pos = k - lits;
       lits[0] = other, lits[1] = r, *k = lit;
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, w);
       j--;
     }
 
@@ -158,8 +162,10 @@ bool Internal::flippable (int lit) {
     return false;
 
   // Need to reestablish proper watching invariants as if there are no
-  // blocking literals as flipping in principle does not work with them.
+  // blocking literals as flipping in principle does not work with them
+  // (nor with tombstones).
 
+  flush_tombstones ();
   if (propergated < trail.size ())
     propergate ();
 
@@ -194,10 +200,12 @@ bool Internal::flippable (int lit) {
       break;
     }
 
-    if (w.clause->garbage)
+    Clause *c = watched_clause (w);
+
+    if (c->garbage)
       continue;
 
-    literal_iterator lits = w.clause->begin ();
+    literal_iterator lits = c->begin ();
 
     const int other = lits[0] ^ lits[1] ^ lit;
     const signed char u = val (other);
@@ -206,8 +214,8 @@ bool Internal::flippable (int lit) {
       continue;
     }
 
-    const int size = w.clause->size;
-    const literal_iterator middle = lits + w.clause->pos;
+    const int size = c->size;
+    const literal_iterator middle = lits + c->pos;
     const const_literal_iterator end = lits + size;
     literal_iterator k = middle;
 
@@ -217,7 +225,7 @@ bool Internal::flippable (int lit) {
       k++;
     if (v < 0) {
       k = lits + 2;
-      assert (w.clause->pos <= size);
+      assert (c->pos <= size);
       while (k != middle && (v = val (r = *k)) < 0)
         k++;
     }
@@ -229,8 +237,8 @@ bool Internal::flippable (int lit) {
 
     assert (v > 0);
     assert (lits + 2 <= k);
-    assert (k <= w.clause->end ());
-    w.clause->pos = k - lits;
+    assert (k <= c->end ());
+    c->pos = k - lits;
     i->blit = r;
   }
 
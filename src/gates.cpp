@@ -161,10 +161,10 @@ void Internal::mark_binary_literals (Eliminator &eliminator, int first) {
           lrat_chain.push_back (id);
           // LOG ("gates added id %" PRId64, id);
         }
-        lrat_chain.push_back (c->id);
-        lrat_chain.push_back (d->id);
-        // LOG ("gates added id %" PRId64, c->id);
-        // LOG ("gates added id %" PRId64, d->id);
+        lrat_chain.push_back (c->id ());
+        lrat_chain.push_back (d->id ());
+        // LOG ("gates added id %" PRId64, c->id ());
+        // LOG ("gates added id %" PRId64, d->id ());
         clear_analyzed_literals ();
       }
       assign_unit (first);
@@ -263,11 +263,11 @@ void Internal::find_equivalence (Eliminator &eliminator, int pivot) {
           lrat_chain.push_back (id);
           // LOG ("gates added id %" PRId64, id);
         }
-        lrat_chain.push_back (c->id);
-        lrat_chain.push_back (d->id);
+        lrat_chain.push_back (c->id ());
+        lrat_chain.push_back (d->id ());
         clear_analyzed_literals ();
-        // LOG ("gates added id %" PRId64, c->id);
-        // LOG ("gates added id %" PRId64, d->id);
+        // LOG ("gates added id %" PRId64, c->id ());
+        // LOG ("gates added id %" PRId64, d->id ());
       }
       assign_unit (second);
       elim_propagate (eliminator, second);
@@ -744,6 +744,7 @@ void Internal::find_gate_clauses (Eliminator &eliminator, int pivot) {
   find_and_gate (eliminator, -pivot);
   find_if_then_else (eliminator, pivot);
   find_xor_gate (eliminator, pivot);
+  find_definition (eliminator, pivot);
 }
 
 void Internal::unmark_gate_clauses (Eliminator &eliminator) {
@@ -753,6 +754,7 @@ void Internal::unmark_gate_clauses (Eliminator &eliminator) {
     c->gate = false;
   }
   eliminator.gates.clear ();
+  eliminator.definition = false;
 }
 
 /*------------------------------------------------------------------------*/
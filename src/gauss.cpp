@@ -0,0 +1,330 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Gaussian elimination on XOR constraints as in Lingeling.  Parity
+// reasoning is hard for CDCL, since an XOR constraint over 'n' variables
+// needs '2^(n-1)' clauses and adding up XOR constraints can not be
+// simulated efficiently by resolution.  If enabled by 'opts.gauss' we
+// extract XOR constraints of size at most 'opts.gaussmaxsize' from the
+// irredundant clauses (in the same way as 'find_xor_gate' does for one
+// pivot), put them into a bit-packed matrix and run Gauss-Jordan
+// elimination on it.
+
+// Every row of the resulting matrix is implied by the formula.  Rows with
+// no variable left but an odd right-hand side show that the formula is
+// unsatisfiable, rows with one variable give units and rows with two
+// variables give equivalences, which are added as binary clauses and then
+// substituted by 'decompose' (see 'probe').  The elimination effort is
+// limited by 'opts.gaussmaxeff' ticks (visited matrix words) and since
+// every row remains an implied XOR constraint we can still use all rows
+// if this limit is hit.  Since sums of XOR constraints can not be
+// justified by a short sequence of resolution steps we do not run Gaussian
+// elimination if proof tracing is enabled.
+
+struct GaussClause {
+  unsigned start; // position of the sorted variables in 'variables'
+  unsigned size;  // number of literals of the clause
+  unsigned signs; // bit 'i' set if 'i'-th literal is negative
+};
+
+struct gauss_clause_smaller {
+  const vector<int> &variables;
+  gauss_clause_smaller (const vector<int> &v) : variables (v) {}
+  bool operator() (const GaussClause &a, const GaussClause &b) const {
+    if (a.size != b.size)
+      return a.size < b.size;
+    for (unsigned i = 0; i < a.size; i++) {
+      const int u = variables[a.start + i], v = variables[b.start + i];
+      if (u != v)
+        return u < v;
+    }
+    const unsigned p = parity (a.signs), q = parity (b.signs);
+    if (p != q)
+      return p < q;
+    return a.signs < b.signs;
+  }
+  static unsigned parity (unsigned signs) {
+    unsigned res = 0;
+    while (signs)
+      res ^= 1, signs &= signs - 1;
+    return res;
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+// Find all XOR constraints for which all '2^(n-1)' clauses are present.
+// Each found constraint is added to 'xors' as its size, its right-hand side
+// ('0' or '1') and then its variables.
+
+void Internal::gauss_extract_xors (vector<int> &xors) {
+
+  vector<int> variables;
+  vector<GaussClause> candidates;
+  vector<int> sorted;
+
+  for (const auto &c : clauses) {
+    if (c->garbage || c->redundant)
+      continue;
+    if (c->size < 3 || c->size > opts.gaussmaxsize)
+      continue;
+    bool assigned = false;
+    for (const auto &lit : *c)
+      if (val (lit)) {
+        assigned = true;
+        break;
+      }
+    if (assigned)
+      continue;
+    sorted.clear ();
+    for (const auto &lit : *c)
+      sorted.push_back (lit);
+    sort (sorted.begin (), sorted.end (), clause_lit_less_than ());
+    GaussClause g;
+    g.start = variables.size ();
+    g.size = sorted.size ();
+    g.signs = 0;
+    for (unsigned i = 0; i < g.size; i++) {
+      const int lit = sorted[i];
+      if (lit < 0)
+        g.signs |= 1u << i;
+      variables.push_back (abs (lit));
+    }
+    candidates.push_back (g);
+  }
+
+  LOG ("found %zd XOR clause candidates", candidates.size ());
+  sort (candidates.begin (), candidates.end (),
+        gauss_clause_smaller (variables));
+
+  // Clauses of the same XOR constraint are now consecutive and their sign
+  // patterns are sorted, thus duplicates are consecutive too.
+
+  const auto begin = candidates.begin (), end = candidates.end ();
+  for (auto i = begin, j = begin; i != end; i = j) {
+    const unsigned size = i->size;
+    const unsigned parity = gauss_clause_smaller::parity (i->signs);
+    const int *const vars = variables.data () + i->start;
+    unsigned different = 0;
+    unsigned prev = ~0u;
+    for (j = i; j != end; j++) {
+      if (j->size != size)
+        break;
+      if (gauss_clause_smaller::parity (j->signs) != parity)
+        break;
+      if (!equal (vars, vars + size, variables.data () + j->start))
+        break;
+      if (j->signs != prev)
+        different++, prev = j->signs;
+    }
+    if (different < 1u << (size - 1))
+      continue;
+
+    // The clause blocks the assignment which falsifies all its literals,
+    // which has the parity of the number of negative literals.
+
+    const int rhs = !parity;
+    xors.push_back (size);
+    xors.push_back (rhs);
+    for (unsigned k = 0; k < size; k++)
+      xors.push_back (vars[k]);
+    stats.gaussxors++;
+    LOG ("found XOR constraint of size %u with right-hand side %d", size,
+         rhs);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::gauss () {
+
+  if (!opts.gauss)
+    return false;
+  if (unsat)
+    return false;
+  if (terminated_asynchronously ())
+    return false;
+  if (proof)
+    return false;
+
+  // Nothing changed since the last time?
+  //
+  if (last.gauss.added == stats.added.irredundant)
+    return false;
+  last.gauss.added = stats.added.irredundant;
+
+  START_SIMPLIFIER (gauss, GAUSS);
+  stats.gauss++;
+
+  assert (!level);
+
+  vector<int> xors;
+  gauss_extract_xors (xors);
+
+  // Map variables of XOR constraints to columns.
+
+  size_t rows = 0;
+  vector<int> columns;
+  for (size_t i = 0; i < xors.size (); i += 2 + xors[i], rows++)
+    for (int k = 0; k < xors[i]; k++)
+      columns.push_back (xors[i + 2 + k]);
+  sort (columns.begin (), columns.end ());
+  columns.resize (unique (columns.begin (), columns.end ()) -
+                  columns.begin ());
+
+  const size_t cols = columns.size ();
+  const size_t words = (cols + 1 + 63) / 64; // with right-hand side
+  const int64_t limit = opts.gaussmaxeff;
+  int64_t ticks = rows * words;
+
+  // Do not even allocate matrices which are too large to be eliminated.
+
+  if (!rows || ticks > limit) {
+    PHASE ("gauss", stats.gauss,
+           "skipping %zd XOR constraints over %zd variables", rows, cols);
+    STOP_SIMPLIFIER (gauss, GAUSS);
+    return false;
+  }
+
+  vector<uint64_t> matrix;
+  matrix.reserve (rows * words);
+  for (size_t i = 0; i < xors.size (); i += 2 + xors[i]) {
+    const size_t offset = matrix.size ();
+    matrix.resize (offset + words, 0);
+    uint64_t *row = matrix.data () + offset;
+    for (int k = 0; k < xors[i]; k++) {
+      const int idx = xors[i + 2 + k];
+      const auto it = lower_bound (columns.begin (), columns.end (), idx);
+      const size_t col = it - columns.begin ();
+      row[col / 64] |= (uint64_t) 1 << (col & 63);
+    }
+    if (xors[i + 1])
+      row[cols / 64] |= (uint64_t) 1 << (cols & 63);
+  }
+  erase_vector (xors);
+
+  PHASE ("gauss", stats.gauss,
+         "eliminating %zd XOR constraints over %zd variables", rows, cols);
+
+  // Gauss-Jordan elimination, i.e., the pivot column is cleared in all
+  // other rows (not only those below the pivot row).
+
+  size_t rank = 0;
+  for (size_t col = 0; col < cols && rank < rows; col++) {
+    if (ticks > limit) {
+      PHASE ("gauss", stats.gauss, "elimination limit of %" PRId64
+             " ticks hit after %zd pivots", limit, rank);
+      break;
+    }
+    const size_t w = col / 64;
+    const uint64_t bit = (uint64_t) 1 << (col & 63);
+    size_t pivot = rank;
+    while (pivot < rows && !(matrix[pivot * words + w] & bit))
+      pivot++;
+    ticks += pivot - rank;
+    if (pivot == rows)
+      continue;
+    uint64_t *const prow = matrix.data () + rank * words;
+    if (pivot != rank)
+      swap_ranges (prow, prow + words, matrix.data () + pivot * words);
+    for (size_t r = 0; r < rows; r++) {
+      if (r == rank)
+        continue;
+      uint64_t *const row = matrix.data () + r * words;
+      if (!(row[w] & bit))
+        continue;
+      for (size_t k = 0; k < words; k++)
+        row[k] ^= prow[k];
+      ticks += words;
+    }
+    ticks += rows;
+    rank++;
+  }
+  stats.gaussticks += ticks;
+
+  // Collect units and equivalences from rows with at most two variables.
+
+  vector<int> units, equivalences;
+  bool inconsistent = false;
+  for (size_t r = 0; !inconsistent && r < rows; r++) {
+    const uint64_t *const row = matrix.data () + r * words;
+    const bool rhs = (row[cols / 64] >> (cols & 63)) & 1;
+    int found[3], count = 0;
+    for (size_t k = 0; count < 3 && k < words; k++) {
+      uint64_t word = row[k];
+      if (k == cols / 64)
+        word &= ~((uint64_t) 1 << (cols & 63));
+      for (unsigned b = 0; word && count < 3; b++, word >>= 1)
+        if (word & 1)
+          found[count++] = columns[64 * k + b];
+    }
+    if (count > 2)
+      continue;
+    if (!count) {
+      if (rhs) {
+        LOG ("Gaussian elimination yields inconsistent XOR constraint");
+        inconsistent = true;
+      }
+    } else if (count == 1)
+      units.push_back (rhs ? found[0] : -found[0]);
+    else
+      equivalences.push_back (found[0]),
+          equivalences.push_back (rhs ? -found[1] : found[1]);
+  }
+  erase_vector (matrix);
+
+  if (inconsistent)
+    learn_empty_clause ();
+
+  for (const auto &lit : units) {
+    if (unsat)
+      break;
+    const signed char tmp = val (lit);
+    if (tmp > 0)
+      continue;
+    if (tmp < 0) {
+      LOG ("Gaussian elimination unit %d already falsified", lit);
+      learn_empty_clause ();
+      break;
+    }
+    LOG ("Gaussian elimination unit %d", lit);
+    stats.gaussunits++;
+    assign_unit (lit);
+  }
+  if (!unsat && !propagate ()) {
+    LOG ("propagating Gaussian elimination units results in conflict");
+    learn_empty_clause ();
+  }
+
+  // An equivalence 'a = b' is added as the two clauses '-a b' and 'a -b'.
+
+  bool added = false;
+  for (size_t i = 0; !unsat && i < equivalences.size (); i += 2) {
+    const int a = equivalences[i], b = equivalences[i + 1];
+    if (val (a) || val (b))
+      continue;
+    LOG ("Gaussian elimination equivalence %d = %d", a, b);
+    stats.gaussequivs++;
+    for (const auto sign : {1, -1}) {
+      assert (clause.empty ());
+      clause.push_back (-sign * a);
+      clause.push_back (sign * b);
+      new_hyper_binary_resolved_clause (true, 2);
+      clause.clear ();
+    }
+    added = true;
+  }
+
+  PHASE ("gauss", stats.gauss,
+         "found %zd units and %zd equivalences from rank %zd matrix",
+         units.size (), equivalences.size () / 2, rank);
+
+  STOP_SIMPLIFIER (gauss, GAUSS);
+
+  return added;
+}
+
+} // namespace CaDiCaL
@@ -0,0 +1,85 @@
+#ifndef _hugepages_hpp_INCLUDED
+#define _hugepages_hpp_INCLUDED
+
+#include "resources.hpp"
+
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Allocator for the large tables indexed by variables or literals ('vtab'
+// and 'wtab').  If 'huge' is set (option 'hugepages' when the first
+// variables are added) allocations of at least 'huge_page_bytes' are
+// rounded up and allocated with 'allocate_huge_pages'.  Whether huge pages
+// are used only depends on the size, thus 'deallocate' does not need to
+// remember how memory was allocated.  The flag is stateful and propagated
+// on assignment and swap, which is needed for 'erase_vector' and
+// 'shrink_vector' to keep the allocation strategy of a table.
+
+template <class T> struct huge_pages_allocator {
+
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  bool huge;
+
+  huge_pages_allocator (bool h = false) : huge (h) {}
+
+  template <class U>
+  huge_pages_allocator (const huge_pages_allocator<U> &other)
+      : huge (other.huge) {}
+
+  bool use_huge_pages (size_t n) const {
+    return huge && n * sizeof (T) >= huge_page_bytes;
+  }
+
+  static size_t rounded_bytes (size_t n) {
+    const size_t mask = huge_page_bytes - 1;
+    return (n * sizeof (T) + mask) & ~mask;
+  }
+
+  // Bytes allocated in huge pages for 'n' elements.
+  //
+  size_t huge_bytes (size_t n) const {
+    return use_huge_pages (n) ? rounded_bytes (n) : 0;
+  }
+
+  T *allocate (size_t n) {
+    if (!use_huge_pages (n))
+      return static_cast<T *> (::operator new (n * sizeof (T)));
+    char *res = allocate_huge_pages (rounded_bytes (n));
+    if (!res)
+      throw std::bad_alloc ();
+    return (T *) res;
+  }
+
+  void deallocate (T *p, size_t n) {
+    if (use_huge_pages (n))
+      deallocate_huge_pages ((char *) p);
+    else
+      ::operator delete (p);
+  }
+};
+
+template <class T, class U>
+bool operator== (const huge_pages_allocator<T> &a,
+                 const huge_pages_allocator<U> &b) {
+  return a.huge == b.huge;
+}
+
+template <class T, class U>
+bool operator!= (const huge_pages_allocator<T> &a,
+                 const huge_pages_allocator<U> &b) {
+  return a.huge != b.huge;
+}
+
+template <class T>
+using huge_vector = std::vector<T, huge_pages_allocator<T>>;
+
+} // namespace CaDiCaL
+
+#endif
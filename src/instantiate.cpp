@@ -94,28 +94,29 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
       if (w.binary ()) {
         if (b < 0) {
           ok = false;
-          LOG (w.clause, "conflict");
+          LOG (watched_clause (w), "conflict");
           if (lrat) {
-            inst_chain.push_back (w.clause);
+            inst_chain.push_back (watched_clause (w));
           }
           break;
         } else {
           if (lrat) {
-            inst_chain.push_back (w.clause);
+            inst_chain.push_back (watched_clause (w));
           }
           inst_assign (w.blit);
         }
       } else {
-        literal_iterator lits = w.clause->begin ();
+        Clause *c = watched_clause (w);
+        literal_iterator lits = c->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
           j[-1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = c->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + c->pos;
           literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
@@ -123,33 +124,33 @@ bool Internal::inst_propagate () { // Adapted from 'propagate'.
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->pos <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          c->pos = k - lits;
+          assert (lits + 2 <= k), assert (k <= c->end ());
           if (v > 0) {
             j[-1].blit = r;
           } else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (c, "unwatch %d in", r);
             lits[1] = r;
             *k = lit;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, w);
             j--;
           } else if (!u) {
             assert (v < 0);
             if (lrat) {
-              inst_chain.push_back (w.clause);
+              inst_chain.push_back (c);
             }
             inst_assign (other);
           } else {
             assert (u < 0);
             assert (v < 0);
             if (lrat) {
-              inst_chain.push_back (w.clause);
+              inst_chain.push_back (c);
             }
-            LOG (w.clause, "conflict");
+            LOG (c, "conflict");
             ok = false;
             break;
           }
@@ -230,7 +231,7 @@ bool Internal::instantiate_candidate (int lit, Clause *c) {
     assert (inst_chain.size ());
     Clause *reason = inst_chain.back ();
     inst_chain.pop_back ();
-    lrat_chain.push_back (reason->id);
+    lrat_chain.push_back (reason->id ());
     for (const auto &other : *reason) {
       Flags &f = flags (other);
       assert (!f.seen);
@@ -250,7 +251,7 @@ bool Internal::instantiate_candidate (int lit, Clause *c) {
       Flags &f = flags (other);
       if (f.seen) {
         Clause *reason = inst_chain.back ();
-        lrat_chain.push_back (reason->id);
+        lrat_chain.push_back (reason->id ());
         for (const auto &other : *reason) {
           Flags &f = flags (other);
           if (f.seen)
@@ -267,7 +268,7 @@ bool Internal::instantiate_candidate (int lit, Clause *c) {
   // post processing step for lrat
   if (!ok && lrat) {
     if (flags (lit).seen)
-      lrat_chain.push_back (c->id);
+      lrat_chain.push_back (c->id ());
     for (const auto &other : *c) {
       Flags &f = flags (other);
       f.seen = false;
@@ -11,16 +11,19 @@ Internal::Internal ()
       protected_reasons (false), force_saved_phase (false),
       searching_lucky_phases (false), stable (false), reported (false),
       external_prop (false), did_external_prop (false),
-      external_prop_is_lazy (true), rephased (0), vsize (0), max_var (0),
-      clause_id (0), original_id (0), reserved_ids (0), conflict_id (0),
+      external_prop_is_lazy (true), rephased (0), vsize (0),
+      huge_tables (false), max_var (0), clause_id (0), original_id (0),
+      reserved_ids (0), conflict_id (0),
       concluded (false), lrat (false), level (0), vals (0), score_inc (1.0),
+      chb (false), chb_step (0),
       scores (this), conflict (0), ignore (0), dummy_binary (0),
       external_reason (&external_reason_clause), newest_clause (0),
       force_no_backtrack (false), from_propagator (false),
       tainted_literal (0), notified (0), probe_reason (0), propagated (0),
       propagated2 (0), propergated (0), best_assigned (0),
       target_assigned (0), no_conflict_until (0), unsat_constraint (false),
-      marked_failed (true), num_assigned (0), proof (0), lratbuilder (0),
+      marked_failed (true), learned_indexed (0), num_assigned (0),
+      mature_clauses (0), proof (0), lratbuilder (0),
       opts (this),
 #ifndef QUIET
       profiles (this), force_phase_messages (false),
@@ -40,14 +43,19 @@ Internal::Internal ()
   // stack, which became incompatible with several compilers (see the
   // discussion on flexible array member in 'Clause.cpp').
 
-  size_t bytes = Clause::bytes (2);
-  dummy_binary = (Clause *) new char[bytes];
-  memset (dummy_binary, 0, bytes);
+  // It always has room for an identifier, since it might be used in
+  // proofs.
+
+  size_t bytes = Clause::bytes (2, true);
+  char *p = new char[bytes];
+  memset (p, 0, bytes);
+  dummy_binary = (Clause *) (p + sizeof (uint64_t));
+  dummy_binary->identified = true;
   dummy_binary->size = 2;
 }
 
 Internal::~Internal () {
-  delete[](char *) dummy_binary;
+  delete[] dummy_binary->start ();
   for (const auto &c : clauses)
     delete_clause (c);
   if (proof)
@@ -60,10 +68,7 @@ Internal::~Internal () {
     delete filetracer;
   for (auto &stattracer : stat_tracers)
     delete stattracer;
-  if (vals) {
-    vals -= vsize;
-    delete[] vals;
-  }
+  deallocate_vals ();
 }
 
 /*------------------------------------------------------------------------*/
@@ -86,21 +91,59 @@ Internal::~Internal () {
 
 static signed char *ignore_clang_analyze_memory_leak_warning;
 
-void Internal::enlarge_vals (size_t new_vsize) {
-  signed char *new_vals;
-  const size_t bytes = 2u * new_vsize;
-  new_vals = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
-  memset (new_vals, 0, bytes);
-  ignore_clang_analyze_memory_leak_warning = new_vals;
-  new_vals += new_vsize;
+// If 'huge_tables' is set large value tables are allocated in huge pages.
+// As for 'huge_pages_allocator' this only depends on the size, which is
+// 'vsize' for the current 'vals' table when deallocating it.
+
+static bool huge_vals (bool huge_tables, size_t size) {
+  return huge_tables && 2 * size >= huge_page_bytes;
+}
+
+signed char *Internal::allocate_vals (size_t size) {
+  signed char *res;
+  const size_t bytes = 2u * size;
+  if (huge_vals (huge_tables, size)) {
+    const size_t rounded = align (bytes, huge_page_bytes);
+    res = (signed char *) allocate_huge_pages (rounded);
+    if (!res)
+      throw std::bad_alloc ();
+  } else
+    res = new signed char[bytes]; // g++-4.8 does not like ... { 0 };
+  memset (res, 0, bytes);
+  ignore_clang_analyze_memory_leak_warning = res;
+  return res + size;
+}
+
+void Internal::deallocate_vals () {
+  if (!vals)
+    return;
+  vals -= vsize;
+  if (huge_vals (huge_tables, vsize))
+    deallocate_huge_pages ((char *) vals);
+  else
+    delete[] vals;
+  vals = 0;
+}
 
+void Internal::enlarge_vals (size_t new_vsize) {
+  signed char *new_vals = allocate_vals (new_vsize);
   if (vals)
     memcpy (new_vals - max_var, vals - max_var, 2u * max_var + 1u);
-  vals -= vsize;
-  delete[] vals;
+  deallocate_vals ();
   vals = new_vals;
 }
 
+// Bytes of 'vals', 'vtab' and 'wtab' allocated in huge pages.
+
+size_t Internal::huge_tables_bytes () const {
+  size_t res = 0;
+  if (huge_vals (huge_tables, vsize))
+    res += align (2 * vsize, huge_page_bytes);
+  res += vtab.get_allocator ().huge_bytes (vtab.capacity ());
+  res += wtab.get_allocator ().huge_bytes (wtab.capacity ());
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 template <class T>
@@ -109,7 +152,8 @@ static void enlarge_init (vector<T> &v, size_t N, const T &i) {
     v.resize (N, i);
 }
 
-template <class T> static void enlarge_only (vector<T> &v, size_t N) {
+template <class T, class A>
+static void enlarge_only (vector<T, A> &v, size_t N) {
   if (v.size () < N)
     v.resize (N, T ());
 }
@@ -126,6 +170,13 @@ void Internal::enlarge (int new_max_var) {
   while (new_vsize <= (size_t) new_max_var)
     new_vsize *= 2;
   LOG ("enlarge internal size from %zd to new size %zd", vsize, new_vsize);
+  if (!vsize && opts.hugepages && huge_pages_supported ()) {
+    LOG ("allocating large tables in huge pages");
+    assert (vtab.empty ()), assert (wtab.empty ());
+    huge_tables = true;
+    huge_vector<Var> (huge_pages_allocator<Var> (true)).swap (vtab);
+    huge_vector<Watches> (huge_pages_allocator<Watches> (true)).swap (wtab);
+  }
   // Ordered in the size of allocated memory (larger block first).
   enlarge_zero (unit_clauses, 2 * new_vsize);
   enlarge_only (wtab, 2 * new_vsize);
@@ -135,8 +186,14 @@ void Internal::enlarge (int new_max_var) {
   enlarge_zero (btab, new_vsize);
   enlarge_zero (gtab, new_vsize);
   enlarge_zero (stab, new_vsize);
+  if (!xtab.empty ()) {
+    enlarge_zero (xtab, new_vsize);
+    enlarge_zero (ctab, new_vsize);
+  }
   enlarge_init (ptab, 2 * new_vsize, -1);
+#ifndef PACKEDVARS
   enlarge_only (ftab, new_vsize);
+#endif
   enlarge_vals (new_vsize);
   enlarge_zero (frozentab, new_vsize);
   enlarge_zero (relevanttab, new_vsize);
@@ -148,6 +205,7 @@ void Internal::enlarge (int new_max_var) {
   enlarge_zero (phases.prev, new_vsize);
   enlarge_zero (phases.min, new_vsize);
   enlarge_zero (marks, new_vsize);
+  enlarge_zero (saved_positions, new_vsize);
   vsize = new_vsize;
 }
 
@@ -364,6 +422,18 @@ void Internal::init_preprocessing_limits () {
 
   /*----------------------------------------------------------------------*/
 
+  // Redundant clauses added during preprocessing (before the search limits
+  // are initialized, e.g., by 'simplify') need the tier boundaries too.
+
+  if (!incremental) {
+    lim.tier1glue = opts.reducetier1glue;
+    lim.tier2glue = opts.reducetier2glue;
+    LOG ("initial tier boundaries %d and %d", lim.tier1glue,
+         lim.tier2glue);
+  }
+
+  /*----------------------------------------------------------------------*/
+
   if (incremental)
     mode = "keeping";
   else {
@@ -415,6 +485,8 @@ void Internal::init_search_limits () {
   else {
     last.reduce.conflicts = -1;
     lim.reduce = stats.conflicts + opts.reduceint;
+    lim.tier1glue = opts.reducetier1glue;
+    lim.tier2glue = opts.reducetier2glue;
     mode = "initial";
   }
   (void) mode;
@@ -470,6 +542,9 @@ void Internal::init_search_limits () {
   } else
     LOG ("keeping non-stable phase");
 
+  if (stable)
+    select_scores ();
+
   inc.stabilize = opts.stabilizeint;
   lim.stabilize = stats.conflicts + inc.stabilize;
   LOG ("new stabilize limit %" PRId64 " after %" PRId64 " conflicts",
@@ -31,6 +31,7 @@ extern "C" {
 // Common 'C++' headers.
 
 #include <algorithm>
+#include <functional>
 #include <queue>
 #include <string>
 #include <unordered_set>
@@ -66,9 +67,11 @@ extern "C" {
 #include "format.hpp"
 #include "frattracer.hpp"
 #include "heap.hpp"
+#include "hugepages.hpp"
 #include "idruptracer.hpp"
 #include "instantiate.hpp"
 #include "internal.hpp"
+#include "learnhash.hpp"
 #include "level.hpp"
 #include "lidruptracer.hpp"
 #include "limit.hpp"
@@ -135,15 +138,16 @@ struct Internal {
     DECOMP = (1 << 3),
     DEDUP = (1 << 4),
     ELIM = (1 << 5),
-    LUCKY = (1 << 6),
-    PROBE = (1 << 7),
-    SEARCH = (1 << 8),
-    SIMPLIFY = (1 << 9),
-    SUBSUME = (1 << 10),
-    TERNARY = (1 << 11),
-    TRANSRED = (1 << 12),
-    VIVIFY = (1 << 13),
-    WALK = (1 << 14),
+    GAUSS = (1 << 6),
+    LUCKY = (1 << 7),
+    PROBE = (1 << 8),
+    SEARCH = (1 << 9),
+    SIMPLIFY = (1 << 10),
+    SUBSUME = (1 << 11),
+    TERNARY = (1 << 12),
+    TRANSRED = (1 << 13),
+    VIVIFY = (1 << 14),
+    WALK = (1 << 15),
   };
 
   bool in_mode (Mode m) const { return (mode & m) != 0; }
@@ -176,6 +180,7 @@ struct Internal {
   char rephased;              // last type of resetting phases
   Reluctant reluctant;        // restart counter in stable mode
   size_t vsize;               // actually allocated variable data size
+  bool huge_tables;           // large tables allocated in huge pages
   int max_var;                // internal maximum variable index
   uint64_t clause_id;         // last used id for clauses
   uint64_t original_id;       // ids for original clauses to produce LRAT
@@ -202,18 +207,24 @@ struct Internal {
   Queue queue;                  // variable move to front decision queue
   Links links;                  // table of links for decision queue
   double score_inc;             // current score increment
+  bool chb;                     // 'stab' contains CHB scores
+  double chb_step;              // CHB step size (alpha)
   ScoreSchedule scores;         // score based decision priority queue
   vector<double> stab;          // table of variable scores [1,max_var]
-  vector<Var> vtab;             // variable table [1,max_var]
+  vector<double> xtab;          // inactive EVSIDS or CHB scores
+  vector<int64_t> ctab;         // last conflict of variables for CHB
+  huge_vector<Var> vtab;        // variable table [1,max_var]
   vector<int> parents;          // parent literals during probing
+#ifndef PACKEDVARS
   vector<Flags> ftab;           // variable and literal flags
+#endif
   vector<int64_t> btab;         // enqueue time stamps for queue
   vector<int64_t> gtab;         // time stamp table to recompute glue
   vector<Occs> otab;            // table of occurrences for all literals
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<Bins> big;             // binary implication graph
-  vector<Watches> wtab;         // table of watches for all literals
+  huge_vector<Watches> wtab;    // table of watches for all literals
   Clause *conflict;             // set in 'propagation', reset in 'analyze'
   Clause *ignore;               // ignored during 'vivify_propagate'
   Clause *dummy_binary;         // Dummy binary clause for subsumption
@@ -243,6 +254,14 @@ struct Internal {
   vector<int> decomposed;    // literals skipped in 'decompose'
   vector<int> minimized;     // removable or poison in 'minimize'
   vector<int> shrinkable;    // removable or poison in 'shrink'
+  vector<int> tombstoned;    // watch lists with tombstones
+  vector<Clause *> buried;   // clauses with tombstone watches
+  vector<Hashed> learned_index;   // hash table of learned clauses
+  size_t learned_indexed;         // number of entries in 'learned_index'
+  vector<int64_t> glue_used;      // bumped redundant clauses per glue
+  vector<int> saved_trail;        // literals unassigned in last backjump
+  vector<Clause *> saved_reasons; // and their reasons
+  vector<unsigned> saved_positions; // of saved decisions (plus one)
   Reap reap;                 // radix heap for shrink
 
   size_t num_assigned; // check for satisfied
@@ -250,6 +269,8 @@ struct Internal {
   vector<int> probes;       // remaining scheduled probes
   vector<Level> control;    // 'level + 1 == control.size ()'
   vector<Clause *> clauses; // ordered collection of all clauses
+  size_t mature_clauses;    // prefix of 'clauses' in mature arena blocks
+  vector<Clause *> mature_garbage; // marked garbage since last collection
   Averages averages;        // glue, size, jump moving averages
   Limit lim;                // limits for various phases
   Last last;                // statistics at last occurrence
@@ -316,7 +337,10 @@ struct Internal {
 
   // Enlarge tables.
   //
+  signed char *allocate_vals (size_t size);
+  void deallocate_vals ();
   void enlarge_vals (size_t new_vsize);
+  size_t huge_tables_bytes () const;
   void enlarge (int new_max_var);
 
   // A variable is 'active' if it is not eliminated nor fixed.
@@ -384,12 +408,20 @@ struct Internal {
   //
   Var &var (int lit) { return vtab[vidx (lit)]; }
   Link &link (int lit) { return links[vidx (lit)]; }
+#ifdef PACKEDVARS
+  Flags &flags (int lit) { return vtab[vidx (lit)].flags; }
+#else
   Flags &flags (int lit) { return ftab[vidx (lit)]; }
+#endif
   int64_t &bumped (int lit) { return btab[vidx (lit)]; }
   int &propfixed (int lit) { return ptab[vlit (lit)]; }
   double &score (int lit) { return stab[vidx (lit)]; }
 
+#ifdef PACKEDVARS
+  const Flags &flags (int lit) const { return vtab[vidx (lit)].flags; }
+#else
   const Flags &flags (int lit) const { return ftab[vidx (lit)]; }
+#endif
 
   bool occurring () const { return !otab.empty (); }
   bool watching () const { return !wtab.empty (); }
@@ -405,6 +437,9 @@ struct Internal {
   void bump_variable_score (int lit);
   void bump_variable_score_inc ();
   void rescale_variable_scores ();
+  void bump_variable_chb (int lit);
+  void update_chb_step ();
+  void select_scores ();
 
   // Marking variables with a sign (positive or negative).
   //
@@ -504,16 +539,78 @@ struct Internal {
   void unmark_clause (); // unmark 'this->clause'
   void unmark (Clause *);
 
+  // Access the clause of a watch.  Without '-DCOMPACTWATCHES' this is just
+  // the pointer stored in the watch, otherwise the 32-bit reference has to
+  // be mapped to the clause in the arena.
+  //
+  inline Clause *watched_clause (const Watch &w) const {
+#ifdef COMPACTWATCHES
+    return (Clause *) arena.dereference (w.ref);
+#else
+    return w.clause;
+#endif
+  }
+
+  // Let watch 'w' point to 'c' (after moving it) and update its size.
+  //
+  inline void update_watch (Watch &w, Clause *c) {
+#ifdef COMPACTWATCHES
+    if (watched_clause (w) != c)
+      w.ref = arena.reference (c);
+    w.ref = (w.ref & ~1u) | (c->size == 2);
+#else
+    w.clause = c;
+    w.size = c->size;
+#endif
+  }
+
+  // Binary watches are kept in front of the watches of larger clauses,
+  // such that 'propagate' can propagate them separately and first.  This
+  // swaps the binary watch 'i' with the first non-binary watch before it.
+  // The watches before 'i' are partitioned this way, thus that watch is
+  // found by binary search (scanning the binary prefix would be quadratic
+  // for literals in many binary clauses added after a larger one).
+  //
+  inline void move_binary_watch_to_front (Watches &ws, watch_iterator i) {
+    assert (i->binary ());
+    if (i == ws.begin () || i[-1].binary ())
+      return;
+    const auto k = partition_point (
+        ws.begin (), i, [] (const Watch &w) { return w.binary (); });
+    assert (k < i);
+    assert (!k->binary ());
+    swap (*k, *i);
+  }
+
   // Watch literal 'lit' in clause with blocking literal 'blit'.
   // Inlined here, since it occurs in the tight inner loop of 'propagate'.
   //
   inline void watch_literal (int lit, int blit, Clause *c) {
     assert (lit != blit);
     Watches &ws = watches (lit);
+#ifdef COMPACTWATCHES
+    ws.push_back (Watch (blit, arena.reference (c) | (c->size == 2)));
+#else
     ws.push_back (Watch (blit, c));
+#endif
+    if (c->size == 2)
+      move_binary_watch_to_front (ws, ws.end () - 1);
     LOG (c, "watch %d blit %d in", lit, blit);
   }
 
+  // Same but moving the watch 'w' of a clause with another literal, which
+  // allows to reuse its clause reference.
+  //
+  inline void watch_literal (int lit, int blit, const Watch &w) {
+#ifdef COMPACTWATCHES
+    assert (lit != blit);
+    watches (lit).push_back (Watch (blit, w.ref));
+    LOG (watched_clause (w), "watch %d blit %d in", lit, blit);
+#else
+    watch_literal (lit, blit, w.clause);
+#endif
+  }
+
   // Add two watches to a clause.  This is used initially during allocation
   // of a clause and during connecting back all watches after preprocessing.
   //
@@ -524,6 +621,35 @@ struct Internal {
     watch_literal (l1, l0, c);
   }
 
+  inline void remove_watch (Watches &ws, Clause *clause) {
+    const auto end = ws.end ();
+    auto i = ws.begin ();
+    for (auto j = i; j != end; j++) {
+      const Watch &w = *i++ = *j;
+      if (watched_clause (w) == clause)
+        i--;
+    }
+    assert (i + 1 == end);
+    ws.resize (i - ws.begin ());
+  }
+
+  // search for the clause and updates the size marked in the watch lists
+  inline void update_watch_size (Watches &ws, int blit, Clause *conflict) {
+    bool found = false;
+    const auto end = ws.end ();
+    for (auto i = ws.begin (); i != end; i++) {
+      Watch &w = *i;
+      if (watched_clause (w) == conflict) {
+        update_watch (w, conflict), w.blit = blit, found = true;
+        if (w.binary ())
+          move_binary_watch_to_front (ws, i);
+      }
+      assert (watched_clause (*i)->garbage || i->binary () ||
+              watched_clause (*i)->size != 2 || !tombstoned.empty ());
+    }
+    assert (found), (void) found;
+  }
+
   inline void unwatch_clause (Clause *c) {
     const int l0 = c->literals[0];
     const int l1 = c->literals[1];
@@ -531,6 +657,63 @@ struct Internal {
     remove_watch (watches (l1), c);
   }
 
+  // Instead of removing the watch of 'lit' in the clause 'c' with a linear
+  // scan over the watch list of 'lit' (as in 'remove_watch') it is kept as
+  // a 'tombstone', i.e., a watch of a clause which does not watch 'lit'
+  // anymore (neither as 'literals[0]' nor 'literals[1]').  Tombstones are
+  // skipped and dropped in 'propagate' and all remaining ones are flushed
+  // by 'flush_tombstones' during backtracking to the root-level and before
+  // garbage collection.  Thus there are no tombstones on the root-level.
+  //
+  inline void mark_tombstoned (int lit) {
+    Flags &f = flags (lit);
+    const unsigned bit = bign (lit);
+    if (f.buried & bit)
+      return;
+    f.buried |= bit;
+    tombstoned.push_back (lit);
+  }
+
+  inline void bury_watch (int lit, Clause *c) {
+    assert (level);
+    assert (c->size > 2);
+    if (!c->buried) {
+      c->buried = true;
+      buried.push_back (c);
+    }
+    mark_tombstoned (lit);
+    stats.tombstones.buried++;
+    LOG (c, "bury watch %d in", lit);
+  }
+
+  // If a clause with tombstones is watched by 'lit' again the tombstone
+  // in the watch list of 'lit' (if there is one) has to be removed first,
+  // since otherwise the clause would be watched twice by 'lit'.
+  //
+  inline void unbury_watch (int lit, Clause *c) {
+    if (!c->buried || !(flags (lit).buried & bign (lit)))
+      return;
+    Watches &ws = watches (lit);
+    const auto end = ws.end ();
+    auto j = ws.begin ();
+    for (auto i = j; i != end; i++)
+      if (watched_clause (*j++ = *i) == c)
+        j--, stats.tombstones.flushed++;
+    ws.resize (j - ws.begin ());
+  }
+
+  void flush_tombstones (int lit);
+  void flush_tombstones ();
+
+  // Remove the watch of 'lit' in 'c' lazily if 'opts.tombstone' is set.
+  //
+  inline void unwatch_literal (int lit, Clause *c) {
+    if (opts.tombstone)
+      bury_watch (lit, c);
+    else
+      remove_watch (watches (lit), c);
+  }
+
   // Update queue to point to last potentially still unassigned variable.
   // All variables after 'queue.unassigned' in bump order are assumed to be
   // assigned.  Then update the 'queue.bumped' field and log it.  This is
@@ -605,6 +788,7 @@ struct Internal {
   void search_assign_external (int lit);
   void search_assume_decision (int decision);
   void assign_unit (int lit);
+  void propagate_binaries ();
   bool propagate ();
 
   void propergate (); // Repropagate without blocking literals.
@@ -620,6 +804,7 @@ struct Internal {
   bool minimize_literal (int lit, int depth = 0);
   void minimize_clause ();
   void calculate_minimize_chain (int lit, std::vector<int> &stack);
+  void minimize_clause_binary (int uip);
 
   // Learning from conflicts in 'analyze.cc'.
   //
@@ -642,6 +827,23 @@ struct Internal {
   void analyze_reason (int lit, Clause *, int &open, int &resolvent_size,
                        int &antecedent_size);
   Clause *new_driving_clause (const int glue, int &jump);
+
+  // Hash index of learned clauses in 'learnhash.cpp'.
+  //
+  uint64_t hash_learned_clause ();
+  void insert_learned_index (const Hashed &);
+  bool resize_learned_index (size_t needed);
+  void index_learned_clause (Clause *, uint64_t hash);
+  Clause *find_learned_clause (uint64_t hash);
+  void reuse_learned_clause (Clause *, int glue);
+  void update_learned_index ();
+
+  // Saving and replaying the trail after backjumps in 'trailsave.cpp'.
+  //
+  void save_trail (int new_level);
+  void clear_saved_trail ();
+  bool saved_reason_forces (int lit, Clause *reason);
+  void replay_saved_trail (size_t pos);
   int find_conflict_level (int &forced);
   int determine_actual_backtrack_level (int jump);
   void otfs_strengthen_clause (Clause *, int, int,
@@ -709,6 +911,7 @@ struct Internal {
   // Lucky feasible case checking.
   //
   int unlucky (int res);
+  int lucky_constant_candidates (bool &all_negative, bool &all_positive);
   int trivially_false_satisfiable ();
   int trivially_true_satisfiable ();
   int forward_false_satisfiable ();
@@ -738,6 +941,7 @@ struct Internal {
   void protect_reasons ();
   void mark_clauses_to_be_flushed ();
   void mark_useless_redundant_clauses_as_garbage ();
+  void recompute_tiers ();
   bool propagate_out_of_order_units ();
   void unprotect_reasons ();
   void reduce ();
@@ -754,11 +958,13 @@ struct Internal {
   void flush_all_occs_and_watches ();
   void update_reason_references ();
   void copy_non_garbage_clauses ();
+  void copy_young_clauses ();
+  bool minor_collection ();
   void delete_garbage_clauses ();
   void check_clause_stats ();
   void check_var_stats ();
   bool arenaing ();
-  void garbage_collection ();
+  void garbage_collection (bool major = false);
 
   // only remove binary clauses from the watches
   void remove_garbage_binaries ();
@@ -782,11 +988,16 @@ struct Internal {
 
   // Regular forward subsumption checking in 'subsume.cpp'.
   //
+  static uint64_t signature_bit (int lit) {
+    return (uint64_t) 1 << (abs (lit) & 63);
+  }
+  uint64_t clause_signature (Clause *);
   bool subsuming ();
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int try_to_subsume_clause (Clause *, uint64_t signature,
+                             vector<SigOccs> &, vector<Clause *> &shrunken);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
@@ -994,6 +1205,11 @@ struct Internal {
 
   Clause *find_binary_clause (int, int);
   void find_gate_clauses (Eliminator &, int pivot);
+
+  // Semantic definition extraction in 'definition.cpp'.
+  //
+  void find_definition (Eliminator &, int pivot);
+
   void unmark_gate_clauses (Eliminator &);
 
   // Bounded variable elimination in 'elim.cpp'.
@@ -1039,6 +1255,11 @@ struct Internal {
   bool ternary_round (int64_t &steps, int64_t &htrs);
   bool ternary ();
 
+  // Gaussian elimination on XOR constraints in 'gauss.cpp'.
+  //
+  void gauss_extract_xors (vector<int> &);
+  bool gauss ();
+
   // Probing in 'probe.cpp'.
   //
   bool probing ();
@@ -1071,7 +1292,6 @@ struct Internal {
   //
   void walk_save_minimum (Walker &);
   Clause *walk_pick_clause (Walker &);
-  unsigned walk_break_value (int lit);
   int walk_pick_lit (Walker &, Clause *);
   void walk_flip_lit (Walker &, int lit);
   int walk_round (int64_t limit, bool prev);
@@ -1464,6 +1684,12 @@ inline bool score_smaller::operator() (unsigned a, unsigned b) {
   return a > b;
 }
 
+inline double ScoreSchedule::score (unsigned e) const {
+  assert (1 <= e);
+  assert (e <= (unsigned) internal->max_var);
+  return internal->stab[e];
+}
+
 /*------------------------------------------------------------------------*/
 
 // Implemented here for keeping it all inline (requires Internal::fixed).
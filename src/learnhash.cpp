@@ -0,0 +1,216 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Conflict analysis can derive the same clause several times, for instance
+// after restarts and rephasing bring the solver back into the same part of
+// the search space.  If enabled by 'opts.learnhash' all learned redundant
+// clauses of size larger than two are indexed in an open addressing hash
+// table (with linear probing).  After analysis the new 1st UIP clause is
+// looked up and if an identical (not yet garbage) clause exists, this
+// clause is reused as driving clause instead of allocating a duplicate.
+// It is watched by the two new watch literals and bumped as if it was used
+// in conflict analysis.  Binary clauses are not indexed since duplicated
+// binary clauses are removed in 'deduplicate' anyhow.
+
+// The hash value does not depend on the order of literals, since the order
+// of the literals in the stored clause is changed during search.  Table
+// entries are never removed during search but only when the index is
+// rebuilt in 'update_learned_index' during garbage collection.  Clauses
+// which became garbage or were strengthened in the mean time are filtered
+// out by comparing sizes and literals and hash values are recomputed when
+// rebuilding the table (literals might also be renamed in 'compact').
+
+// The table has a power of two size and is kept at most half full.  Its
+// size is bounded by 'opts.learnhashlim' (in MB).  When full, further
+// learned clauses are not indexed until garbage collection made room.
+
+static inline uint64_t hash_literal (int lit) {
+  uint64_t res = (uint64_t) (int64_t) lit * 0x9e3779b97f4a7c15ull;
+  res ^= res >> 29;
+  res *= 0xbf58476d1ce4e5b9ull;
+  return res ^ (res >> 32);
+}
+
+static inline size_t reduce_learned_hash (uint64_t hash, size_t size) {
+  assert (size > 0);
+  return (size_t) (hash ^ (hash >> 32)) & (size - 1);
+}
+
+template <class T> static uint64_t hash_literals (const T &lits) {
+  uint64_t res = 0, size = 0;
+  for (const auto &lit : lits)
+    res += hash_literal (lit), size++;
+  return res + size;
+}
+
+uint64_t Internal::hash_learned_clause () { return hash_literals (clause); }
+
+/*------------------------------------------------------------------------*/
+
+// Add the entry to the table without checking the load (which has to be
+// done by the caller).
+
+void Internal::insert_learned_index (const Hashed &entry) {
+  const size_t size = learned_index.size ();
+  assert (learned_indexed < size);
+  size_t pos = reduce_learned_hash (entry.hash, size);
+  while (learned_index[pos].clause)
+    if (++pos == size)
+      pos = 0;
+  learned_index[pos] = entry;
+  learned_indexed++;
+}
+
+// Make room for at least 'needed' entries and rehash the current ones.
+// Returns 'false' if this would exceed the memory limit.
+
+bool Internal::resize_learned_index (size_t needed) {
+  size_t new_size = 1024;
+  while (new_size < 2 * needed)
+    new_size *= 2;
+  const size_t limit = (size_t) opts.learnhashlim << 20;
+  if (new_size * sizeof (Hashed) > limit)
+    return false;
+  if (new_size == learned_index.size ())
+    return true;
+  vector<Hashed> old;
+  old.swap (learned_index);
+  learned_index.resize (new_size);
+  learned_indexed = 0;
+  for (const auto &entry : old)
+    if (entry.clause)
+      insert_learned_index (entry);
+  LOG ("resized learned clause index to %zd entries", new_size);
+  return true;
+}
+
+void Internal::index_learned_clause (Clause *c, uint64_t hash) {
+  assert (opts.learnhash);
+  assert (c->redundant);
+  assert (c->size > 2);
+  if (2 * (learned_indexed + 1) > learned_index.size () &&
+      !resize_learned_index (learned_indexed + 1)) {
+    stats.learnhash.full++;
+    return;
+  }
+  insert_learned_index (Hashed (hash, c));
+  stats.learnhash.indexed++;
+  LOG (c, "indexed learned");
+}
+
+// Find a clause with exactly the literals in the global 'clause'.
+
+Clause *Internal::find_learned_clause (uint64_t hash) {
+  const size_t size = learned_index.size ();
+  if (!learned_indexed)
+    return 0;
+  stats.learnhash.searched++;
+  const int clause_size = clause.size ();
+  size_t pos = reduce_learned_hash (hash, size);
+  Clause *res = 0;
+  bool marked_clause = false;
+  for (;;) {
+    const Hashed &entry = learned_index[pos];
+    Clause *d = entry.clause;
+    if (!d)
+      break;
+    if (++pos == size)
+      pos = 0;
+    if (entry.hash != hash)
+      continue;
+    if (d->garbage || d->size != clause_size)
+      continue;
+    if (!marked_clause) {
+      for (const auto &lit : clause)
+        mark (lit);
+      marked_clause = true;
+    }
+    bool found = true;
+    for (const auto &lit : *d)
+      if (marked (lit) <= 0) {
+        found = false;
+        break;
+      }
+    if (found) {
+      res = d;
+      break;
+    }
+  }
+  if (marked_clause)
+    for (const auto &lit : clause)
+      unmark (lit);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Replace the newly learned clause by its identical copy 'c'.  The literals
+// of 'c' are overwritten by the ones in 'clause' which are ordered such
+// that the 1st UIP literal and the literal with the highest remaining level
+// are watched.  Since both clauses contain the same literals no proof step
+// is needed.
+
+void Internal::reuse_learned_clause (Clause *c, int glue) {
+  assert (c->size == (int) clause.size ());
+  assert (!c->garbage);
+  LOG (c, "reusing identical learned");
+  const int l0 = c->literals[0], l1 = c->literals[1];
+  const int n0 = clause[0], n1 = clause[1];
+  for (const auto &lit : {l0, l1})
+    if (lit != n0 && lit != n1)
+      unwatch_literal (lit, c);
+  for (const auto &lit : {n0, n1})
+    if (lit != l0 && lit != l1) {
+      unbury_watch (lit, c);
+      watch_literal (lit, lit == n0 ? n1 : n0, c);
+    }
+  int *literals = c->literals;
+  for (const auto &lit : clause)
+    *literals++ = lit;
+  c->pos = 2;
+  c->used = 1 + (glue <= lim.tier2glue);
+  if (c->redundant)
+    promote_clause (c, glue);
+  stats.learnhash.reused++;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called during garbage collection after clauses have been copied but
+// before collected clauses are deleted.  Removes references to collected
+// clauses, updates references to moved clauses and rebuilds the table.
+// Note that the first literals of moved clauses are overwritten by the
+// 'copy' reference and thus hash values are computed from the copies.
+
+void Internal::update_learned_index () {
+  if (learned_index.empty ())
+    return;
+  vector<Hashed> entries;
+  entries.reserve (learned_indexed);
+  for (const auto &entry : learned_index) {
+    Clause *c = entry.clause;
+    if (!c)
+      continue;
+    if (c->collect ())
+      continue;
+    if (c->moved)
+      c = c->copy ();
+    const uint64_t hash = hash_literals (*c);
+    entries.push_back (Hashed (hash, c));
+  }
+  LOG ("keeping %zd of %zd indexed learned clauses", entries.size (),
+       learned_indexed);
+  erase_vector (learned_index);
+  learned_indexed = 0;
+  if (entries.empty () || !opts.learnhash)
+    return;
+  resize_learned_index (entries.size ());
+  for (const auto &entry : entries)
+    if (2 * (learned_indexed + 1) <= learned_index.size ())
+      insert_learned_index (entry);
+}
+
+} // namespace CaDiCaL
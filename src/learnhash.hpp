@@ -0,0 +1,23 @@
+#ifndef _learnhash_hpp_INCLUDED
+#define _learnhash_hpp_INCLUDED
+
+#include <cstdint>
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Entry of the hash index of learned clauses in 'learnhash.cpp'.  The hash
+// value is kept next to the clause reference, such that probing the table
+// only needs to dereference clauses with matching hash values.
+
+struct Hashed {
+  uint64_t hash;
+  Clause *clause;
+  Hashed (uint64_t h, Clause *c) : hash (h), clause (c) {}
+  Hashed () : hash (0), clause (0) {}
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -27,6 +27,9 @@ struct Limit {
   int keptsize; // maximum kept size in 'reduce'
   int keptglue; // maximum kept glue in 'reduce'
 
+  int tier1glue; // maximum glue of tier one clauses
+  int tier2glue; // maximum glue of tier two clauses
+
   // How often rephased during (1) or out (0) of stabilization.
   //
   int64_t rephased[2];
@@ -60,7 +63,10 @@ struct Last {
     int64_t marked;
   } ternary;
   struct {
-    int64_t fixed;
+    int64_t added;
+  } gauss;
+  struct {
+    int64_t fixed, major;
   } collect;
   Last ();
 };
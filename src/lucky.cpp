@@ -27,10 +27,18 @@ int Internal::unlucky (int res) {
   return res;
 }
 
-int Internal::trivially_false_satisfiable () {
-  LOG ("checking that all clauses contain a negative literal");
+// Both constant assignments can only succeed if every clause contains a
+// literal of the corresponding sign.  Instead of traversing all clauses for
+// each of them separately, both conditions are checked in a single pass,
+// which stops as soon as a purely positive and a purely negative clause
+// (ignoring falsified literals) are found.  Returns '-1' if terminated.
+
+int Internal::lucky_constant_candidates (bool &all_negative,
+                                         bool &all_positive) {
+  LOG ("checking that all clauses contain a negative or positive literal");
   assert (!level);
   assert (assumptions.empty ());
+  all_negative = all_positive = true;
   for (const auto &c : clauses) {
     if (terminated_asynchronously (100))
       return unlucky (-1);
@@ -39,6 +47,7 @@ int Internal::trivially_false_satisfiable () {
     if (c->redundant)
       continue;
     bool satisfied = false, found_negative_literal = false;
+    bool found_positive_literal = false;
     for (const auto &lit : *c) {
       const signed char tmp = val (lit);
       if (tmp > 0) {
@@ -47,17 +56,33 @@ int Internal::trivially_false_satisfiable () {
       }
       if (tmp < 0)
         continue;
-      if (lit > 0)
-        continue;
-      found_negative_literal = true;
-      break;
+      if (lit < 0)
+        found_negative_literal = true;
+      else
+        found_positive_literal = true;
+      if (found_negative_literal && found_positive_literal)
+        break;
     }
-    if (satisfied || found_negative_literal)
+    if (satisfied)
       continue;
-    LOG (c, "found purely positively");
-    return unlucky (0);
+    if (all_negative && !found_negative_literal) {
+      LOG (c, "found purely positively");
+      all_negative = false;
+    }
+    if (all_positive && !found_positive_literal) {
+      LOG (c, "found purely negatively");
+      all_positive = false;
+    }
+    if (!all_negative && !all_positive)
+      break;
   }
+  return 0;
+}
+
+int Internal::trivially_false_satisfiable () {
   VERBOSE (1, "all clauses contain a negative literal");
+  assert (!level);
+  assert (assumptions.empty ());
   for (auto idx : vars) {
     if (terminated_asynchronously (10))
       return unlucky (-1);
@@ -75,36 +100,9 @@ int Internal::trivially_false_satisfiable () {
 }
 
 int Internal::trivially_true_satisfiable () {
-  LOG ("checking that all clauses contain a positive literal");
+  VERBOSE (1, "all clauses contain a positive literal");
   assert (!level);
   assert (assumptions.empty ());
-  for (const auto &c : clauses) {
-    if (terminated_asynchronously (100))
-      return unlucky (-1);
-    if (c->garbage)
-      continue;
-    if (c->redundant)
-      continue;
-    bool satisfied = false, found_positive_literal = false;
-    for (const auto &lit : *c) {
-      const signed char tmp = val (lit);
-      if (tmp > 0) {
-        satisfied = true;
-        break;
-      }
-      if (tmp < 0)
-        continue;
-      if (lit < 0)
-        continue;
-      found_positive_literal = true;
-      break;
-    }
-    if (satisfied || found_positive_literal)
-      continue;
-    LOG (c, "found purely negatively");
-    return unlucky (0);
-  }
-  VERBOSE (1, "all clauses contain a positive literal");
   for (auto idx : vars) {
     if (terminated_asynchronously (10))
       return unlucky (-1);
@@ -353,12 +351,19 @@ int Internal::lucky_phases () {
   assert (!searching_lucky_phases);
   searching_lucky_phases = true;
   stats.lucky.tried++;
-  int res = trivially_false_satisfiable ();
-  if (!res)
+  bool all_negative, all_positive;
+  int res = lucky_constant_candidates (all_negative, all_positive);
+  if (!res && all_negative)
+    res = trivially_false_satisfiable ();
+  if (!res && all_positive)
     res = trivially_true_satisfiable ();
-  if (!res)
+  // The constant assignments are tried in increasing variable order and
+  // thus if they were tried and failed the corresponding forward strategy
+  // would fail in exactly the same way and can be skipped.
+  //
+  if (!res && !all_positive)
     res = forward_true_satisfiable ();
-  if (!res)
+  if (!res && !all_negative)
     res = forward_false_satisfiable ();
   if (!res)
     res = backward_false_satisfiable ();
@@ -51,6 +51,77 @@ bool Internal::minimize_literal (int lit, int depth) {
   return res;
 }
 
+// Binary implication graph based minimization as in Glucose and Kissat.
+// After minimization (and shrinking) a literal 'lit' can be removed from
+// the learned clause if '-lit' is implied by the first UIP through a chain
+// of binary clauses (the clause contains the negation of the UIP and can
+// be resolved with these binary clauses).  The binary implication graph is
+// traversed breadth-first starting at the UIP following only binary
+// watches and true literals, which is bounded by visiting at most
+// 'opts.minimizebinlim' watches.  Since no LRAT chain is produced for
+// these resolutions this is skipped if LRAT proofs are generated.
+
+void Internal::minimize_clause_binary (int uip) {
+  assert (!lrat);
+  assert (val (uip) > 0);
+  START (minimize);
+  LOG (clause, "binary minimizing first UIP %d clause", uip);
+
+  for (const auto &lit : clause)
+    if (lit != -uip)
+      mark67 (lit);
+
+  std::vector<int> reached;
+  reached.push_back (uip);
+  setbit (uip, 0);
+
+  int64_t ticks = opts.minimizebinlim;
+  size_t remaining = clause.size () - 1, removed = 0;
+  for (size_t next = 0; remaining && next < reached.size (); next++) {
+    const int lit = reached[next];
+    for (const auto &w : watches (-lit)) {
+      if (!w.binary ())
+        break;
+      if (ticks-- <= 0)
+        goto DONE;
+      const int other = w.blit;
+      if (val (other) <= 0)
+        continue;
+      if (getbit (other, 0))
+        continue;
+      setbit (other, 0);
+      reached.push_back (other);
+      if (marked67 (-other) <= 0)
+        continue;
+      LOG ("binary implication %d -> %d removes %d", lit, other, -other);
+      unmark67 (-other);
+      removed++;
+      if (!--remaining)
+        break;
+    }
+  }
+
+DONE:
+
+  for (const auto &lit : reached)
+    unsetbit (lit, 0);
+
+  const auto end = clause.end ();
+  auto j = clause.begin ();
+  for (auto i = j; i != end; i++) {
+    const int lit = *i;
+    if (lit == -uip)
+      *j++ = lit;
+    else if (marked67 (lit) > 0)
+      unmark67 (lit), *j++ = lit;
+  }
+  assert ((size_t) (end - j) == removed);
+  clause.resize (j - clause.begin ());
+  stats.minimizedbin += removed;
+  LOG ("binary minimized %zd literals", removed);
+  STOP (minimize);
+}
+
 // Sorting the clause before minimization with respect to the trail order
 // (literals with smaller trail height first) is necessary but natural and
 // might help to minimize the required recursion depth too.
@@ -151,7 +222,7 @@ void Internal::calculate_minimize_chain (int lit, std::vector<int> &stack) {
     stack.pop_back ();
     if (idx < 0) {
       Var &v = var (idx);
-      mini_chain.push_back (v.reason->id);
+      mini_chain.push_back (v.reason->id ());
       continue;
     }
     assert (idx);
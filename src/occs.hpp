@@ -1,6 +1,7 @@
 #ifndef _occs_h_INCLUDED
 #define _occs_h_INCLUDED
 
+#include <cstdint>
 #include <vector>
 
 namespace CaDiCaL {
@@ -31,6 +32,17 @@ inline void remove_occs (Occs &os, Clause *c) {
 typedef Occs::iterator occs_iterator;
 typedef Occs::const_iterator const_occs_iterator;
 
+// Forward subsumption connects clauses together with their signature (see
+// 'clause_signature' in 'subsume.cpp'), which allows to skip most of the
+// connected clauses without accessing them.
+
+struct SigOcc {
+  uint64_t signature;
+  Clause *clause;
+};
+
+typedef vector<SigOcc> SigOccs;
+
 } // namespace CaDiCaL
 
 #endif
@@ -23,9 +23,13 @@
 \
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
+OPTION( arenaminor,        1,  0,  1,0,0,1, "minor generational collections") \
+OPTION( arenanursery,      1,  0,  1,0,0,1, "allocate new clauses in arena") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
+OPTION( arenawaste,       25,  0,100,0,0,1, "mature garbage percent for major") \
 OPTION( binary,            1,  0,  1,0,0,1, "use binary proof format") \
+OPTION( binfirst,          1,  0,  1,0,0,1, "propagate binary clauses first") \
 OPTION( block,             0,  0,  1,0,1,1, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( blockminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
@@ -33,6 +37,9 @@ OPTION( blockocclim,     1e2,  1,2e9,2,0,1, "occurrence limit") \
 OPTION( bump,              1,  0,  1,0,0,1, "bump variables") \
 OPTION( bumpreason,        1,  0,  1,0,0,1, "bump reason literals too") \
 OPTION( bumpreasondepth,   1,  1,  3,0,0,1, "bump reason depth") \
+OPTION( chb,               0,  0,  2,0,0,1, "CHB scores in stable mode (2=alternate)") \
+OPTION( chbstep,         400,  1,1e3,0,0,1, "initial CHB step size per mille") \
+OPTION( chbstepmin,       60,  1,1e3,0,0,1, "minimum CHB step size per mille") \
 OPTION( check,             0,  0,  1,0,0,0, "enable internal checking") \
 OPTION( checkassumptions,  1,  0,  1,0,0,0, "check assumptions satisfied") \
 OPTION( checkconstraint,   1,  0,  1,0,0,0, "check constraint satisfied") \
@@ -72,6 +79,8 @@ OPTION( elimbackward,      1,  0,  1,0,0,1, "eager backward subsumption") \
 OPTION( elimboundmax,     16, -1,2e6,1,0,1, "maximum elimination bound") \
 OPTION( elimboundmin,      0, -1,2e6,0,0,1, "minimum elimination bound") \
 OPTION( elimclslim,      1e2,  2,2e9,2,0,1, "resolvent size limit") \
+OPTION( elimdefs,          1,  0,  1,0,0,1, "find definitions semantically") \
+OPTION( elimdefticks,    2e3,  0,1e6,1,0,1, "definition solver ticks limit") \
 OPTION( elimequivs,        1,  0,  1,0,0,1, "find equivalence gates") \
 OPTION( elimineff,       1e7,  0,2e9,1,0,1, "minimum elimination efficiency") \
 OPTION( elimint,         2e3,  1,2e9,0,0,1, "elimination interval") \
@@ -98,6 +107,10 @@ OPTION( flushfactor,       3,  1,1e3,0,0,1, "interval increase") \
 OPTION( flushint,        1e5,  1,2e9,0,0,1, "initial limit") \
 OPTION( forcephase,        0,  0,  1,0,0,1, "always use initial phase") \
 OPTION( frat,              0,  0,  2,0,0,1, "1=frat(lrat), 2=frat(drat)") \
+OPTION( gauss,             0,  0,  1,0,1,1, "Gaussian elimination on XORs") \
+OPTION( gaussmaxeff,     1e7,  0,2e9,1,0,1, "maximum elimination ticks") \
+OPTION( gaussmaxsize,      5,  3,  8,0,0,1, "maximum XOR size") \
+OPTION( hugepages,         0,  0,  1,0,0,1, "huge pages for arena and tables") \
 OPTION( idrup,             0,  0,  1,0,0,1, "incremental proof format") \
 OPTION( ilb,               1,  0,  1,0,0,1, "ILB (incremental lazy backtrack)") \
 OPTION( ilbassumptions,    1,  0,  1,0,0,1, "trail reuse for assumptions (ILB-like)") \
@@ -106,15 +119,20 @@ OPTION( instantiate,       0,  0,  1,0,1,1, "variable instantiation") \
 OPTION( instantiateclslim, 3,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( instantiateocclim, 1,  1,2e9,2,0,1, "maximum occurrence limit") \
 OPTION( instantiateonce,   1,  0,  1,0,0,1, "instantiate each clause once") \
+OPTION( learnhash,         0,  0,  1,0,0,1, "reuse identical learned clauses") \
+OPTION( learnhashlim,     64,  1,2e3,0,0,1, "learned clause index memory (MB)") \
 OPTION( lidrup,            0,  0,  1,0,0,1, "linear incremental proof format") \
 LOGOPT( log,               0,  0,  1,0,0,0, "enable logging") \
 LOGOPT( logsort,           0,  0,  1,0,0,0, "sort logged clauses") \
 OPTION( lrat,              0,  0,  1,0,0,1, "use LRAT proof format") \
 OPTION( lucky,             1,  0,  1,0,0,1, "search for lucky phases") \
 OPTION( minimize,          1,  0,  1,0,0,1, "minimize learned clauses") \
+OPTION( minimizebin,       1,  0,  1,0,0,1, "binary implication minimization") \
+OPTION( minimizebinlim,  1e3,  0,2e9,0,0,1, "binary minimization watch limit") \
 OPTION( minimizedepth,   1e3,  0,1e3,0,0,1, "minimization depth") \
 OPTION( otfs,              1,  0,  1,0,0,1, "on-the-fly self subsumption") \
 OPTION( phase,             1,  0,  1,0,0,1, "initial phase") \
+OPTION( prefetch,          4,  0, 64,0,0,1, "prefetch distance (0=disable)") \
 OPTION( probe,             1,  0,  1,0,1,1, "failed literal probing" ) \
 OPTION( probehbr,          1,  0,  1,0,0,1, "learn hyper binary clauses") \
 OPTION( probeint,        5e3,  1,2e9,0,0,1, "probing interval" ) \
@@ -130,7 +148,10 @@ OPTION( reduce,            1,  0,  1,0,0,1, "reduce useless clauses") \
 OPTION( reduceint,       300, 10,1e6,0,0,1, "reduce interval") \
 OPTION( reducetarget,     75, 10,1e2,0,0,1, "reduce fraction in percent") \
 OPTION( reducetier1glue,   2,  1,2e9,0,0,1, "glue of kept learned clauses") \
+OPTION( reducetier1used,  50,  1,100,0,0,1, "tier one usage in percent") \
 OPTION( reducetier2glue,   6,  1,2e9,0,0,1, "glue of tier two clauses") \
+OPTION( reducetier2used,  90,  1,100,0,0,1, "tier two usage in percent") \
+OPTION( reducetieradapt,   1,  0,  1,0,0,1, "adapt tiers to glue usage") \
 OPTION( reluctant,      1024,  0,2e9,0,0,1, "reluctant doubling period") \
 OPTION( reluctantmax,1048576,  0,2e9,0,0,1, "reluctant doubling period") \
 OPTION( rephase,           1,  0,  1,0,0,1, "enable resetting phase") \
@@ -147,6 +168,7 @@ OPTION( restoreflush,      0,  0,  1,0,0,1, "remove satisfied clauses") \
 OPTION( reverse,           0,  0,  1,0,0,1, "reverse variable ordering") \
 OPTION( score,             1,  0,  1,0,0,1, "use EVSIDS scores") \
 OPTION( scorefactor,     950,500,1e3,0,0,1, "score factor per mille") \
+OPTION( scoreheap,         1,  1,  3,0,0,1, "score heap arity 2^n (1=binary)") \
 OPTION( seed,              0,  0,2e9,0,0,1, "random seed") \
 OPTION( shrink,            3,  0,  3,0,0,1, "shrink conflict clause") \
 OPTION( shrinkreap,        1,  0,  1,0,0,1, "use a reap for shrinking") \
@@ -179,6 +201,8 @@ OPTION( ternarymineff,   1e6,  1,2e9,1,0,1, "minimum ternary efficiency") \
 OPTION( ternaryocclim,   1e2,  1,2e9,2,0,1, "ternary occurrence limit") \
 OPTION( ternaryreleff,    10,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( ternaryrounds,     2,  1, 16,1,0,1, "maximum ternary rounds") \
+OPTION( tombstone,         1,  0,  1,0,0,1, "lazy watch removal with tombstones") \
+OPTION( trailsave,         0,  0,  1,0,0,1, "save and replay trail after backjumps") \
 OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,2e9,1,0,1, "minimum efficiency") \
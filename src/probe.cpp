@@ -138,7 +138,7 @@ void Internal::probe_dominator_lrat (int dom, Clause *reason) {
     assert (id);
     lrat_chain.push_back (id);
   }
-  lrat_chain.push_back (reason->id);
+  lrat_chain.push_back (reason->id ());
 }
 
 /*------------------------------------------------------------------------*/
@@ -368,7 +368,7 @@ inline void Internal::probe_lrat_for_units (int lit) {
     uint64_t id = unit_clauses[uidx];
     lrat_chain.push_back (id);
   }
-  lrat_chain.push_back (probe_reason->id);
+  lrat_chain.push_back (probe_reason->id ());
 }
 
 /*------------------------------------------------------------------------*/
@@ -393,12 +393,13 @@ inline void Internal::probe_propagate2 () {
       const signed char b = val (w.blit);
       if (b > 0)
         continue;
+      Clause *c = watched_clause (w);
       if (b < 0)
-        conflict = w.clause; // but continue
+        conflict = c; // but continue
       else {
         assert (lrat_chain.empty ());
         assert (!probe_reason);
-        probe_reason = w.clause;
+        probe_reason = c;
         probe_lrat_for_units (w.blit);
         probe_assign (w.blit, -lit);
         lrat_chain.clear ();
@@ -427,18 +428,19 @@ bool Internal::probe_propagate () {
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
-        if (w.clause->garbage)
+        Clause *c = watched_clause (w);
+        if (c->garbage)
           continue;
-        const literal_iterator lits = w.clause->begin ();
+        const literal_iterator lits = c->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         // lits[0] = other, lits[1] = lit;
         const signed char u = val (other);
         if (u > 0)
           ws[j - 1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = c->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + c->pos;
           literal_iterator k = middle;
           int r = 0;
           signed char v = -1;
@@ -446,39 +448,39 @@ bool Internal::probe_propagate () {
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->pos <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          c->pos = k - lits;
+          assert (lits + 2 <= k), assert (k <= c->end ());
           if (v > 0)
             ws[j - 1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (c, "unwatch %d in", r);
             *k = lit;
             lits[0] = other;
             lits[1] = r;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, w);
             j--;
           } else if (!u) {
             if (level == 1) {
               lits[0] = other, lits[1] = lit;
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              int dom = hyper_binary_resolve (w.clause);
+              int dom = hyper_binary_resolve (c);
               probe_assign (other, dom);
             } else {
               assert (lrat_chain.empty ());
               assert (!probe_reason);
-              probe_reason = w.clause;
+              probe_reason = c;
               probe_lrat_for_units (other);
               probe_assign_unit (other);
               lrat_chain.clear ();
             }
             probe_propagate2 ();
           } else
-            conflict = w.clause;
+            conflict = c;
         }
       }
       if (j != i) {
@@ -883,6 +885,9 @@ void CaDiCaL::Internal::probe (bool update_limits) {
   if (ternary ()) // If we derived a binary clause
     decompose (); // then start another round of ELS.
 
+  if (gauss ())   // If Gaussian elimination found equivalences
+    decompose (); // then substitute them too.
+
   // Remove duplicated binary clauses and perform in essence hyper unary
   // resolution, i.e., derive the unit '2' from '1 2' and '-1 2'.
   //
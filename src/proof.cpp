@@ -267,7 +267,7 @@ void Proof::add_derived_clause (Clause *c, const vector<uint64_t> &chain) {
   add_literals (c);
   for (const auto &cid : chain)
     proof_chain.push_back (cid);
-  clause_id = c->id;
+  clause_id = c->id ();
   redundant = c->redundant;
   add_derived_clause ();
 }
@@ -331,7 +331,7 @@ void Proof::delete_clause (Clause *c) {
   LOG (c, "PROOF deleting from proof");
   assert (clause.empty ());
   add_literals (c);
-  clause_id = c->id;
+  clause_id = c->id ();
   redundant = c->redundant;
   delete_clause (); // Increments 'statistics.deleted'.
 }
@@ -349,7 +349,7 @@ void Proof::weaken_minus (Clause *c) {
   LOG (c, "PROOF weaken minus of");
   assert (clause.empty ());
   add_literals (c);
-  clause_id = c->id;
+  clause_id = c->id ();
   weaken_minus ();
 }
 
@@ -384,7 +384,7 @@ void Proof::finalize_clause (Clause *c) {
   LOG (c, "PROOF finalizing clause");
   assert (clause.empty ());
   add_literals (c);
-  clause_id = c->id;
+  clause_id = c->id ();
   finalize_clause ();
 }
 
@@ -433,13 +433,13 @@ void Proof::flush_clause (Clause *c) {
     }
     add_literal (internal_lit);
   }
-  proof_chain.push_back (c->id);
+  proof_chain.push_back (c->id ());
   redundant = c->redundant;
   int64_t id = ++internal->clause_id;
   clause_id = id;
   add_derived_clause ();
   delete_clause (c);
-  c->id = id;
+  c->set_id (id);
 }
 
 // While strengthening clauses, e.g., through self-subsuming resolutions,
@@ -465,7 +465,7 @@ void Proof::strengthen_clause (Clause *c, int remove,
     proof_chain.push_back (cid);
   add_derived_clause ();
   delete_clause (c);
-  c->id = id;
+  c->set_id (id);
 }
 
 void Proof::otfs_strengthen_clause (Clause *c, const std::vector<int> &old,
@@ -482,8 +482,8 @@ void Proof::otfs_strengthen_clause (Clause *c, const std::vector<int> &old,
   for (const auto &cid : chain)
     proof_chain.push_back (cid);
   add_derived_clause ();
-  delete_clause (c->id, c->redundant, old);
-  c->id = id;
+  delete_clause (c->id (), c->redundant, old);
+  c->set_id (id);
 }
 
 void Proof::strengthen (uint64_t id) {
@@ -76,7 +76,7 @@ void Internal::build_chain_for_units (int lit, Clause *reason,
     uint64_t id = unit_clauses[uidx];
     lrat_chain.push_back (id);
   }
-  lrat_chain.push_back (reason->id);
+  lrat_chain.push_back (reason->id ());
 }
 
 // same code as above but reason is assumed to be conflict and lit is not
@@ -95,7 +95,7 @@ void Internal::build_chain_for_empty () {
     uint64_t id = unit_clauses[uidx];
     lrat_chain.push_back (id);
   }
-  lrat_chain.push_back (conflict->id);
+  lrat_chain.push_back (conflict->id ());
 }
 
 /*------------------------------------------------------------------------*/
@@ -224,6 +224,42 @@ void Internal::search_assign_external (int lit) {
 // propagation costs (2013 JAIR article by Ian Gent) at the expense of four
 // more bytes for each clause.
 
+// Visiting a watch of a larger clause with a false blocking literal means
+// accessing the clause, which is usually a cache miss.  Therefore we
+// prefetch the clause of the watch 'opts.prefetch' entries ahead (unless
+// its blocking literal is already satisfied).  The number of prefetches
+// and how many of the prefetched clauses are actually visited later is
+// counted in 'stats.prefetch'.
+
+// Unless 'opts.binfirst' is disabled, all binary clauses are propagated
+// before any larger clause is visited, using the separate trail position
+// 'propagated2' as in 'probe_propagate'.  Since binary watches are kept in
+// front of the watch lists (see 'watch_literal') this only traverses the
+// (dense) binary prefix of the watch lists and never touches clause memory
+// except for finding the reason of a new assignment or a conflict.
+
+inline void Internal::propagate_binaries () {
+  while (!conflict && propagated2 != trail.size ()) {
+    const int lit = -trail[propagated2++];
+    LOG ("propagating %d over binary clauses", -lit);
+    for (const auto &w : watches (lit)) {
+      if (!w.binary ())
+        break;
+      const signed char b = val (w.blit);
+      if (b > 0)
+        continue;
+      Clause *c = watched_clause (w);
+      if (b < 0) {
+        conflict = c;
+        break;
+      }
+      build_chain_for_units (w.blit, c, 0);
+      search_assign (w.blit, c);
+      // lrat_chain.clear (); done in search_assign
+    }
+  }
+}
+
 bool Internal::propagate () {
 
   if (level)
@@ -237,7 +273,37 @@ bool Internal::propagate () {
   //
   int64_t before = propagated;
 
-  while (!conflict && propagated != trail.size ()) {
+  const bool binary_first = opts.binfirst;
+  if (binary_first)
+    propagated2 = propagated;
+
+  const int prefetch = opts.prefetch;
+  int64_t prefetched = 0, useful = 0;
+
+  // Tombstones (see 'bury_watch') only exist if some watch list has them.
+  //
+  const bool tombstones = !tombstoned.empty ();
+  int64_t skipped = 0;
+
+  for (;;) {
+
+    if (binary_first)
+      propagate_binaries ();
+
+    if (conflict || propagated == trail.size ())
+      break;
+
+    // Assign saved implied literals early (see 'trailsave.cpp').
+    //
+    if (!saved_trail.empty () && level) {
+      const int lit = trail[propagated];
+      const unsigned pos = saved_positions[vidx (lit)];
+      if (pos && saved_trail[pos - 1] == lit) {
+        replay_saved_trail (pos - 1);
+        if (conflict)
+          break;
+      }
+    }
 
     const int lit = -trail[propagated++];
     LOG ("propagating %d", -lit);
@@ -247,8 +313,24 @@ bool Internal::propagate () {
     watch_iterator j = ws.begin ();
     const_watch_iterator i = j;
 
+    // Binary watches in front were already propagated.
+    //
+    if (binary_first)
+      while (i != eow && i->binary ())
+        i++, j++;
+
+    const const_watch_iterator first = i;
+
     while (i != eow) {
 
+      if (prefetch && eow - i > prefetch) {
+        const Watch &ahead = i[prefetch];
+        if (!ahead.binary () && val (ahead.blit) <= 0) {
+          __builtin_prefetch (watched_clause (ahead), 0, 1);
+          prefetched++;
+        }
+      }
+
       const Watch w = *j++ = *i++;
       const signed char b = val (w.blit);
 
@@ -257,12 +339,12 @@ bool Internal::propagate () {
 
       if (w.binary ()) {
 
-        // assert (w.clause->redundant || !w.clause->garbage);
+        // assert (c->redundant || !c->garbage);
 
         // In principle we can ignore garbage binary clauses too, but that
         // would require to dereference the clause pointer all the time with
         //
-        // if (w.clause->garbage) { j--; continue; } // (*)
+        // if (c->garbage) { j--; continue; } // (*)
         //
         // This is too costly.  It is however necessary to produce correct
         // proof traces if binary clauses are traced to be deleted ('d ...'
@@ -284,31 +366,44 @@ bool Internal::propagate () {
         // to access the clause at all (only during conflict analysis, and
         // there also only to simplify the code).
 
+        Clause *c = watched_clause (w);
         if (b < 0)
-          conflict = w.clause; // but continue ...
+          conflict = c; // but continue ...
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          search_assign (w.blit, w.clause);
+          build_chain_for_units (w.blit, c, 0);
+          search_assign (w.blit, c);
           // lrat_chain.clear (); done in search_assign
         }
 
       } else {
-        assert (w.clause->size > 2);
+        Clause *c = watched_clause (w);
+        assert (tombstones || c->size > 2);
 
         if (conflict)
           break; // Stop if there was a binary conflict already.
 
+        if (prefetch && i - first > prefetch)
+          useful++;
+
         // The cache line with the clause data is forced to be loaded here
         // and thus this first memory access below is the real hot-spot of
         // the solver.  Note, that this check is positive very rarely and
         // thus branch prediction should be almost perfect here.
 
-        if (w.clause->garbage) {
+        if (c->garbage) {
+          j--;
+          continue;
+        }
+
+        literal_iterator lits = c->begin ();
+
+        if (tombstones && lits[0] != lit && lits[1] != lit) {
+          skipped++;
           j--;
           continue;
         }
 
-        literal_iterator lits = w.clause->begin ();
+        assert (c->size > 2);
 
         // Simplify code by forcing 'lit' to be the second literal in the
         // clause.  This goes back to MiniSAT.  We use a branch-less version
@@ -334,8 +429,8 @@ bool Internal::propagate () {
           // one failed to find a replacement another one starting at the
           // first non-watched literal until the saved position.
 
-          const int size = w.clause->size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const int size = c->size;
+          const literal_iterator middle = lits + c->pos;
           const const_literal_iterator end = lits + size;
           literal_iterator k = middle;
 
@@ -350,14 +445,14 @@ bool Internal::propagate () {
           if (v < 0) { // need second search starting at the head?
 
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->pos <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
 
-          w.clause->pos = k - lits; // always save position
+          c->pos = k - lits; // always save position
 
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          assert (lits + 2 <= k), assert (k <= c->end ());
 
           if (v > 0) {
 
@@ -369,13 +464,15 @@ bool Internal::propagate () {
 
             // Found new unassigned replacement literal to be watched.
 
-            LOG (w.clause, "unwatch %d in", lit);
+            LOG (c, "unwatch %d in", lit);
 
             lits[0] = other;
             lits[1] = r;
             *k = lit;
 
-            watch_literal (r, lit, w.clause);
+            if (tombstones)
+              unbury_watch (r, c);
+            watch_literal (r, lit, w);
 
             j--; // Drop this watch from the watch list of 'lit'.
 
@@ -386,8 +483,8 @@ bool Internal::propagate () {
             // The other watch is unassigned ('!u') and all other literals
             // assigned to false (still 'v < 0'), thus we found a unit.
             //
-            build_chain_for_units (other, w.clause, 0);
-            search_assign (other, w.clause);
+            build_chain_for_units (other, c, 0);
+            search_assign (other, c);
             // lrat_chain.clear (); done in search_assign
 
             // Similar code is in the implementation of the SAT'18 paper on
@@ -417,11 +514,13 @@ bool Internal::propagate () {
                 assert (s);
                 assert (pos < size);
 
-                LOG (w.clause, "unwatch %d in", lit);
+                LOG (c, "unwatch %d in", lit);
                 lits[pos] = lit;
                 lits[0] = other;
                 lits[1] = s;
-                watch_literal (s, other, w.clause);
+                if (tombstones)
+                  unbury_watch (s, c);
+                watch_literal (s, other, w);
 
                 j--; // Drop this watch from the watch list of 'lit'.
               }
@@ -434,7 +533,7 @@ bool Internal::propagate () {
             // The other watch is assigned false ('u < 0') and all other
             // literals as well (still 'v < 0'), thus we found a conflict.
 
-            conflict = w.clause;
+            conflict = c;
             break;
           }
         }
@@ -460,6 +559,9 @@ bool Internal::propagate () {
     // Avoid updating stats eagerly in the hot-spot of the solver.
     //
     stats.propagations.search += propagated - before;
+    stats.prefetch.issued += prefetched;
+    stats.prefetch.useful += useful;
+    stats.tombstones.skipped += skipped;
 
     if (!conflict)
       no_conflict_until = propagated;
@@ -507,12 +609,13 @@ void Internal::propergate () {
         assert (val (w.blit) > 0);
         continue;
       }
-      if (w.clause->garbage) {
+      Clause *c = watched_clause (w);
+      if (c->garbage) {
         j--;
         continue;
       }
 
-      literal_iterator lits = w.clause->begin ();
+      literal_iterator lits = c->begin ();
 
       const int other = lits[0] ^ lits[1] ^ lit;
       const signed char u = val (other);
@@ -521,8 +624,8 @@ void Internal::propergate () {
         continue;
       assert (u < 0);
 
-      const int size = w.clause->size;
-      const literal_iterator middle = lits + w.clause->pos;
+      const int size = c->size;
+      const literal_iterator middle = lits + c->pos;
       const const_literal_iterator end = lits + size;
       literal_iterator k = middle;
 
@@ -534,23 +637,23 @@ void Internal::propergate () {
 
       if (v < 0) {
         k = lits + 2;
-        assert (w.clause->pos <= size);
+        assert (c->pos <= size);
         while (k != middle && (v = val (r = *k)) < 0)
           k++;
       }
 
-      assert (lits + 2 <= k), assert (k <= w.clause->end ());
-      w.clause->pos = k - lits;
+      assert (lits + 2 <= k), assert (k <= c->end ());
+      c->pos = k - lits;
 
       assert (v > 0);
 
-      LOG (w.clause, "unwatch %d in", lit);
+      LOG (c, "unwatch %d in", lit);
 
       lits[0] = other;
       lits[1] = r;
       *k = lit;
 
-      watch_literal (r, lit, w.clause);
+      watch_literal (r, lit, w);
 
       j--;
     }
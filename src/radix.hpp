@@ -37,6 +37,19 @@ struct pointer_rank {
   Type operator() (void *ptr) { return (size_t) ptr; }
 };
 
+// The implementation below makes one pass over the ranks to check whether
+// they are already sorted, which is quite common (the 'analyzed' literals
+// during bumping are often close to 'enqueued' order and clauses in the
+// arena are usually sorted already).  This check stops at the first
+// inversion and thus is cheap otherwise.  Then a single pass computes the
+// histograms of all digits (bytes) at once, instead of one counting pass
+// per digit as in earlier versions.  Digits which are the same for all
+// ranks (as the upper bytes of time stamps and the zero bytes of small
+// glue and size keys) have a single full bucket and are skipped.  Then
+// only one scattering pass per remaining digit is needed.  For the common
+// 32-bit and 64-bit ranks the number of digits is a compile time constant
+// and the compiler can unroll (and vectorize) the inner histogram loop.
+
 template <class I, class Rank> void rsort (I first, I last, Rank rank) {
   typedef typename iterator_traits<I>::value_type T;
   typedef typename Rank::Type R;
@@ -46,10 +59,23 @@ template <class I, class Rank> void rsort (I first, I last, Rank rank) {
   if (n <= 1)
     return;
 
-  const size_t l = 8;        // Radix 8, thus byte-wise.
-  const size_t w = (1 << l); // So many buckets.
+  {
+    I p = first;
+    R prev = rank (*p);
+    while (++p != last) {
+      const R r = rank (*p);
+      if (r < prev)
+        break;
+      prev = r;
+    }
+    if (p == last)
+      return;
+  }
 
-  const unsigned mask = w - 1; // Fast mod 'w'.
+  const size_t l = 8;               // Radix 8, thus byte-wise.
+  const size_t w = (1 << l);        // So many buckets.
+  const size_t digits = sizeof (R); // Number of digits of ranks.
+  const unsigned mask = w - 1;      // Fast mod 'w'.
 
 // Uncomment the following define for large values of 'w' in order to keep
 // the large bucket array 'count' on the heap instead of the stack.
@@ -57,63 +83,37 @@ template <class I, class Rank> void rsort (I first, I last, Rank rank) {
 // #define CADICAL_RADIX_BUCKETS_ON_THE_HEAP
 //
 #ifdef CADICAL_RADIX_BUCKETS_ON_THE_HEAP
-  size_t *count = new size_t[w]; // Put buckets on the heap.
+  size_t *count = new size_t[digits * w]; // Put buckets on the heap.
 #else
-  size_t count[w]; // Put buckets on the stack.
+  size_t count[digits * w]; // Put buckets on the stack.
 #endif
 
-  I a = first, b = last, c = a;
-  bool initialized = false;
-  vector<T> v;
-
-  R upper = 0, lower = ~upper;
-  R shifted = mask;
-  bool bounded = false;
-
-  R masked_lower = 0, masked_upper = mask;
-
-  for (size_t i = 0; i < 8 * sizeof (rank (*first));
-       i += l, shifted <<= l) {
+  memset (count, 0, digits * w * sizeof *count);
 
-    if (bounded && (lower & shifted) == (upper & shifted))
-      continue;
+  for (I p = first; p != last; p++) {
+    const R r = rank (*p);
+    for (size_t k = 0; k < digits; k++)
+      count[k * w + ((r >> (k * l)) & mask)]++;
+  }
 
-    memset (count + masked_lower, 0,
-            (masked_upper - masked_lower + 1) * sizeof *count);
+  const R r0 = rank (*first);
 
-    const I end = c + n;
-    bool sorted = true;
-    R last = 0;
-
-    for (I p = c; p != end; p++) {
-      const auto r = rank (*p);
-      if (!bounded)
-        lower &= r, upper |= r;
-      const auto s = r >> i;
-      const auto m = s & mask;
-      if (sorted && last > m)
-        sorted = false;
-      else
-        last = m;
-      count[m]++;
-    }
+  I a = first, b = last, c = a;
+  bool initialized = false;
+  vector<T> v;
 
-    masked_lower = (lower >> i) & mask;
-    masked_upper = (upper >> i) & mask;
+  for (size_t k = 0; k < digits; k++) {
 
-    if (!bounded) {
-      bounded = true;
-      if ((lower & shifted) == (upper & shifted))
-        continue;
-    }
+    size_t *bucket = count + k * w;
+    const size_t i = k * l;
 
-    if (sorted)
+    if (bucket[(r0 >> i) & mask] == n)
       continue;
 
     size_t pos = 0;
-    for (R j = masked_lower; j <= masked_upper; j++) {
-      const size_t delta = count[j];
-      count[j] = pos;
+    for (size_t j = 0; j < w; j++) {
+      const size_t delta = bucket[j];
+      bucket[j] = pos;
       pos += delta;
     }
 
@@ -126,11 +126,12 @@ template <class I, class Rank> void rsort (I first, I last, Rank rank) {
 
     I d = (&*c == &*a) ? b : a; // MS VC++
 
+    const I end = c + n;
     for (I p = c; p != end; p++) {
       const auto r = rank (*p);
       const auto s = r >> i;
       const auto m = s & mask;
-      d[count[m]++] = *p;
+      d[bucket[m]++] = *p;
     }
     c = d;
   }
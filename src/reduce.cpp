@@ -63,36 +63,28 @@ void Internal::mark_clauses_to_be_flushed () {
 //
 // In earlier versions we pre-computed a 64-bit sort key per clause and
 // wrapped a pointer to the clause and the 64-bit sort key into a separate
-// data structure for sorting.  This was probably faster but awkward and
-// so we moved back to a simpler scheme which also uses 'stable_sort'
-// instead of 'rsort' below.  Sorting here is not a hot-spot anyhow.
-
-struct reduce_less_useful {
-  bool operator() (const Clause *c, const Clause *d) const {
-    if (c->glue > d->glue)
-      return true;
-    if (c->glue < d->glue)
-      return false;
-    return c->size > d->size;
-  }
-};
-
-// This function implements the important reduction policy. It determines
-// which redundant clauses are considered not useful and thus will be
-// collected in a subsequent garbage collection phase.
+// data structure for sorting.  Then we moved back to a simpler scheme using
+// 'stable_sort' and later the radix sort 'rsort'.  However, we only need
+// to know which clauses are among the 'target' least useful ones and not
+// their order.  Thus the victims are now selected in linear time.  First
+// the candidates are counted per glue to determine the glue 'limit' such
+// that all clauses with larger glue are collected but not all with glue
+// 'limit'.  Among the latter the sizes are partially sorted with
+// 'nth_element' to find the size limit.  Ties between clauses with the
+// same glue and size are broken in favor of keeping more recently learned
+// clauses, which gives exactly the same victims as stable sorting.
 
 void Internal::mark_useless_redundant_clauses_as_garbage () {
 
-  // We use a separate stack for sorting candidates for removal.  This uses
-  // (slightly) more memory but has the advantage to keep the relative order
-  // in 'clauses' intact, which actually due to using stable sorting goes
-  // into the candidate selection (more recently learned clauses are kept if
-  // they otherwise have the same glue and size).
+  // We use a separate stack for candidates for removal, which keeps the
+  // relative order of 'clauses' for breaking ties (see above).
 
   vector<Clause *> stack;
 
   stack.reserve (stats.current.redundant);
 
+  vector<size_t> count (Clause::max_glue + 1, 0);
+
   for (const auto &c : clauses) {
     if (!c->redundant)
       continue; // Keep irredundant.
@@ -115,10 +107,9 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
       continue; // Forced to keep (see above).
 
     stack.push_back (c);
+    count[c->glue]++;
   }
 
-  stable_sort (stack.begin (), stack.end (), reduce_less_useful ());
-
   size_t target = 1e-2 * opts.reducetarget * stack.size ();
 
   // This is defensive code, which I usually consider a bug, but here I am
@@ -131,26 +122,65 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
   PHASE ("reduce", stats.reductions, "reducing %zd clauses %.0f%%", target,
          percent (target, stats.current.redundant));
 
-  auto i = stack.begin ();
-  const auto t = i + target;
-  while (i != t) {
-    Clause *c = *i++;
-    LOG (c, "marking useless to be collected");
-    mark_garbage (c);
-    stats.reduced++;
+  // Find the glue limit 'glue_limit' such that all clauses with larger
+  // glue are collected, and the number 'remaining' of clauses with exactly
+  // this glue which have to be collected too.
+
+  int glue_limit = Clause::max_glue + 1;
+  size_t remaining = target;
+  while (remaining && glue_limit > 0) {
+    const size_t glued = count[--glue_limit];
+    if (glued >= remaining)
+      break;
+    remaining -= glued;
+  }
+  erase_vector (count);
+
+  // Among the clauses with glue 'glue_limit' the 'remaining' largest are
+  // collected.  Clauses of size larger than 'size_limit' are collected and
+  // the first 'ties' clauses of size equal to 'size_limit'.
+
+  int size_limit = INT_MAX;
+  size_t ties = 0;
+  if (remaining) {
+    vector<int> sizes;
+    for (const auto &c : stack)
+      if (c->glue == (unsigned) glue_limit)
+        sizes.push_back (c->size);
+    assert (remaining <= sizes.size ());
+    const auto nth = sizes.begin () + (remaining - 1);
+    nth_element (sizes.begin (), nth, sizes.end (), greater<int> ());
+    size_limit = *nth;
+    ties = remaining;
+    for (const auto &size : sizes)
+      if (size > size_limit)
+        ties--;
   }
 
   lim.keptsize = lim.keptglue = 0;
 
-  const auto end = stack.end ();
-  for (i = t; i != end; i++) {
-    Clause *c = *i;
-    LOG (c, "keeping");
-    if (c->size > lim.keptsize)
-      lim.keptsize = c->size;
-    if (c->glue > lim.keptglue)
-      lim.keptglue = c->glue;
+  for (const auto &c : stack) {
+    const int glue = c->glue;
+    bool collect = glue > glue_limit;
+    if (!collect && glue == glue_limit) {
+      if (c->size > size_limit)
+        collect = true;
+      else if (c->size == size_limit && ties)
+        collect = true, ties--;
+    }
+    if (collect) {
+      LOG (c, "marking useless to be collected");
+      mark_garbage (c);
+      stats.reduced++;
+    } else {
+      LOG (c, "keeping");
+      if (c->size > lim.keptsize)
+        lim.keptsize = c->size;
+      if (c->glue > lim.keptglue)
+        lim.keptglue = c->glue;
+    }
   }
+  assert (!ties);
 
   erase_vector (stack);
 
@@ -160,6 +190,55 @@ void Internal::mark_useless_redundant_clauses_as_garbage () {
 
 /*------------------------------------------------------------------------*/
 
+// Fixed tier boundaries ('opts.reducetier1glue' and 'opts.reducetier2glue')
+// do not fit all instances.  Thus with 'opts.reducetieradapt' the glue of
+// redundant clauses used in conflict analysis is counted in 'bump_clause'
+// and before every reduction the boundaries are set to the smallest glue
+// such that clauses up to that glue account for 'opts.reducetier1used'
+// respectively 'opts.reducetier2used' percent of all uses.  The counts are
+// halved afterwards to give more weight to recent conflicts.  The fixed
+// options serve as initial values and as upper bounds, such that adapting
+// the tiers never keeps more clauses than the fixed boundaries would.
+// Clauses already in tier one remain there ('keep' is not reset).
+
+void Internal::recompute_tiers () {
+  if (!opts.reducetieradapt)
+    return;
+  int64_t total = 0;
+  for (const auto &count : glue_used)
+    total += count;
+  if (!total)
+    return;
+  stats.tiers++;
+  const int64_t limit1 = 1e-2 * opts.reducetier1used * total;
+  const int64_t limit2 = 1e-2 * opts.reducetier2used * total;
+  int tier1 = 0, tier2 = 0;
+  int64_t sum = 0;
+  for (size_t glue = 0; glue < glue_used.size (); glue++) {
+    sum += glue_used[glue];
+    glue_used[glue] /= 2;
+    if (!tier1 && sum >= limit1)
+      tier1 = (int) glue;
+    if (!tier2 && sum >= limit2)
+      tier2 = (int) glue;
+  }
+  if (tier1 < 1)
+    tier1 = 1;
+  if (tier1 > opts.reducetier1glue)
+    tier1 = opts.reducetier1glue;
+  if (tier2 < tier1)
+    tier2 = tier1;
+  if (tier2 > opts.reducetier2glue)
+    tier2 = opts.reducetier2glue;
+  lim.tier1glue = tier1;
+  lim.tier2glue = tier2;
+  PHASE ("reduce", stats.reductions,
+         "tier one glue %d and tier two glue %d after %" PRId64 " uses",
+         tier1, tier2, total);
+}
+
+/*------------------------------------------------------------------------*/
+
 // If chronological backtracking produces out-of-order assigned units, then
 // it is necessary to completely propagate them at the root level in order
 // to derive all implied units.  Otherwise the blocking literals in
@@ -195,6 +274,11 @@ void Internal::reduce () {
   stats.reductions++;
   report ('.', 1);
 
+  // Measured independently of profiling to report the latency of single
+  // reductions (see 'reducetime' and 'reducemax' in the statistics).
+  //
+  const double start = time ();
+
   bool flush = flushing ();
   if (flush)
     stats.flush.count++;
@@ -202,6 +286,7 @@ void Internal::reduce () {
   if (!propagate_out_of_order_units ())
     goto DONE;
 
+  recompute_tiers ();
   mark_satisfied_clauses_as_garbage ();
   protect_reasons ();
   if (flush)
@@ -236,6 +321,11 @@ void Internal::reduce () {
 
 DONE:
 
+  const double delta = time () - start;
+  stats.reducetime += delta;
+  if (delta > stats.reducemax)
+    stats.reducemax = delta;
+
   report (flush ? 'f' : '-');
   STOP (reduce);
 }
@@ -27,6 +27,7 @@ extern "C" {
 
 #else
 
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -34,6 +35,7 @@ extern "C" {
 
 #endif
 
+#include <stdlib.h>
 #include <string.h>
 }
 
@@ -157,4 +159,51 @@ uint64_t current_resident_set_size () {
 
 /*------------------------------------------------------------------------*/
 
+#if !defined(__WIN32) && defined(MADV_HUGEPAGE)
+
+// Transparent huge pages are requested with 'madvise' for anonymous memory
+// aligned to 2 MB.  Whether the kernel actually backs the memory with huge
+// pages depends on '/sys/kernel/mm/transparent_hugepage/enabled' (which has
+// to be 'always' or 'madvise') and on fragmentation of physical memory.
+
+bool huge_pages_supported () { return true; }
+
+char *allocate_huge_pages (size_t bytes) {
+  assert (!(bytes % huge_page_bytes));
+  void *res;
+  if (posix_memalign (&res, huge_page_bytes, bytes))
+    return 0;
+  (void) madvise (res, bytes, MADV_HUGEPAGE);
+  return (char *) res;
+}
+
+void deallocate_huge_pages (char *p) { free (p); }
+
+// The 'smaps_rollup' file is available since Linux 4.14 and accumulates
+// the 'AnonHugePages' entries of all mappings of the process.
+
+uint64_t huge_pages_resident_set_size () {
+  FILE *file = fopen ("/proc/self/smaps_rollup", "r");
+  if (!file)
+    return 0;
+  uint64_t res = 0;
+  char line[128];
+  while (fgets (line, sizeof line, file))
+    if (sscanf (line, "AnonHugePages: %" PRIu64 " kB", &res) == 1)
+      break;
+  fclose (file);
+  return res << 10;
+}
+
+#else
+
+bool huge_pages_supported () { return false; }
+char *allocate_huge_pages (size_t) { return 0; }
+void deallocate_huge_pages (char *) { assert (false); }
+uint64_t huge_pages_resident_set_size () { return 0; }
+
+#endif
+
+/*------------------------------------------------------------------------*/
+
 } // namespace CaDiCaL
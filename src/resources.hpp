@@ -1,6 +1,7 @@
 #ifndef _resources_hpp_INCLUDED
 #define _resources_hpp_INCLUDED
 
+#include <cstddef>
 #include <cstdint>
 
 namespace CaDiCaL {
@@ -11,6 +12,17 @@ double absolute_process_time ();
 uint64_t maximum_resident_set_size ();
 uint64_t current_resident_set_size ();
 
+// Transparent huge pages are only supported on Linux.  Allocation returns
+// zero if they are not available.
+
+const size_t huge_page_bytes = 1u << 21;
+
+bool huge_pages_supported ();
+char *allocate_huge_pages (size_t bytes);
+void deallocate_huge_pages (char *);
+
+uint64_t huge_pages_resident_set_size ();
+
 } // namespace CaDiCaL
 
 #endif // ifndef _resources_hpp_INCLUDED
@@ -27,8 +27,10 @@ bool Internal::stabilizing () {
     else
       STOP (unstable);
     stable = !stable;
-    if (stable)
+    if (stable) {
       stats.stabphases++;
+      select_scores ();
+    }
     PHASE ("stabilizing", stats.stabphases,
            "reached stabilization limit %" PRId64 " after %" PRId64
            " conflicts",
@@ -9,6 +9,8 @@ namespace CaDiCaL {
 void Internal::init_scores (int old_max_var, int new_max_var) {
   LOG ("initializing EVSIDS scores from %d to %d", old_max_var + 1,
        new_max_var);
+  if (scores.empty ())
+    scores.configure (opts.scoreheap);
   for (int i = old_max_var; i < new_max_var; i++)
     scores.push_back (i + 1);
 }
@@ -20,6 +22,8 @@ void Internal::shuffle_scores () {
     return;
   if (!opts.shufflescores)
     return;
+  if (chb)
+    return;
   assert (!level);
   stats.shuffled++;
   LOG ("shuffling scores");
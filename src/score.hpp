@@ -1,6 +1,8 @@
 #ifndef _score_hpp_INCLUDED
 #define _score_hpp_INCLUDED
 
+#include <cstdint>
+
 namespace CaDiCaL {
 
 struct score_smaller {
@@ -9,7 +11,223 @@ struct score_smaller {
   bool operator() (unsigned a, unsigned b);
 };
 
-typedef heap<score_smaller> ScoreSchedule;
+// The EVSIDS scores are kept in a 'd-ary' heap with arity '2^shift', where
+// 'shift' is set by 'opts.scoreheap' (default '1' thus a binary heap).  In
+// contrast to the generic 'heap' the score of each variable is copied into
+// the heap entry, such that comparing children does not need to access the
+// score table 'stab' (one cache miss per child otherwise).  Scores of the
+// entries are updated in 'push_back' and 'update' and thus the client has
+// to call 'update' after changing the score of a variable in the heap (and
+// 'rescale' after rescaling all scores).  The heap array is aligned such
+// that for 4-ary heaps all the children of a node (4 entries of 16 bytes)
+// share a single cache line and for 8-ary heaps two adjacent cache lines.
+
+// Since 'less' is a total order (ties are broken by variable index) the
+// maximum variable and thus the decisions do not depend on the arity, and
+// for binary heaps even all positions are the same as with the generic
+// 'heap<score_smaller>' used before.  Thus the arity only changes speed.
+
+class ScoreSchedule {
+
+  struct Entry {
+    double score;
+    unsigned idx;
+  };
+
+  static const size_t cache_line_bytes = 64;
+  static const size_t slack = cache_line_bytes / sizeof (Entry);
+
+  Internal *internal;
+  vector<Entry> storage; // heap entries plus alignment slack
+  Entry *array;          // aligned start of heap in 'storage'
+  size_t count;          // number of elements in heap
+  vector<unsigned> pos;  // positions of elements in 'array'
+  unsigned shift;        // 'log2 (arity)'
+
+  double score (unsigned e) const; // Defined in 'internal.hpp'.
+
+  // Same as 'score_smaller' but on the copied scores.
+  //
+  static bool less (const Entry &a, const Entry &b) {
+    if (a.score < b.score)
+      return true;
+    if (a.score > b.score)
+      return false;
+    return a.idx > b.idx;
+  }
+
+  // Reallocate 'storage' to hold at least 'needed' entries.  The start
+  // of 'array' is chosen such that the first child 'array + 1' of the
+  // root and thus all the groups of children are cache line aligned.
+  //
+  void reallocate (size_t needed) {
+    vector<Entry> tmp (needed + slack);
+    Entry *aligned = tmp.data ();
+    const uintptr_t misaligned =
+        (uintptr_t) (aligned + 1) % cache_line_bytes;
+    if (misaligned && !(misaligned % sizeof (Entry)))
+      aligned += (cache_line_bytes - misaligned) / sizeof (Entry);
+    for (size_t i = 0; i < count; i++)
+      aligned[i] = array[i];
+    storage.swap (tmp);
+    array = aligned;
+  }
+
+  void reserve (size_t needed) {
+    const size_t capacity =
+        array ? storage.data () + storage.size () - array : 0;
+    if (needed <= capacity)
+      return;
+    reallocate (needed > 2 * capacity ? needed : 2 * capacity);
+  }
+
+  void place (size_t i, const Entry &entry) {
+    array[i] = entry;
+    pos[entry.idx] = (unsigned) i;
+  }
+
+  // Bubble up an entry as far as necessary.
+  //
+  void up (size_t i) {
+    const Entry entry = array[i];
+    while (i) {
+      const size_t parent = (i - 1) >> shift;
+      if (!less (array[parent], entry))
+        break;
+      place (i, array[parent]);
+      i = parent;
+    }
+    place (i, entry);
+  }
+
+  // Bubble down an entry as far as necessary.
+  //
+  void down (size_t i) {
+    const Entry entry = array[i];
+    for (;;) {
+      const size_t first = (i << shift) + 1;
+      if (first >= count)
+        break;
+      size_t last = first + ((size_t) 1 << shift);
+      if (last > count)
+        last = count;
+      size_t child = first;
+      for (size_t j = first + 1; j < last; j++)
+        if (less (array[child], array[j]))
+          child = j;
+      if (!less (entry, array[child]))
+        break;
+      place (i, array[child]);
+      i = child;
+    }
+    place (i, entry);
+  }
+
+  // Very expensive checker for the heap invariant (see also 'heap.hpp').
+  //
+  void check () {
+#if 0 // EXPENSIVE HEAP CHECKING IF ENABLED
+#warning "expensive checking in score heap enabled"
+    for (size_t i = 0; i < count; i++) {
+      assert (array[i].score == score (array[i].idx));
+      assert (pos[array[i].idx] == i);
+      if (i)
+        assert (!less (array[(i - 1) >> shift], array[i]));
+    }
+#endif
+  }
+
+public:
+  ScoreSchedule (Internal *i)
+      : internal (i), array (0), count (0), shift (1) {}
+
+  // Set the arity to '2^new_shift', which requires an empty heap.
+  //
+  void configure (unsigned new_shift) {
+    assert (empty ());
+    assert (new_shift > 0);
+    shift = new_shift;
+  }
+
+  size_t size () const { return count; }
+  bool empty () const { return !count; }
+
+  bool contains (unsigned e) const {
+    if ((size_t) e >= pos.size ())
+      return false;
+    return pos[e] != invalid_heap_position;
+  }
+
+  void push_back (unsigned e) {
+    assert (!contains (e));
+    assert (count < (size_t) invalid_heap_position);
+    if ((size_t) e >= pos.size ())
+      pos.resize (1 + (size_t) e, invalid_heap_position);
+    reserve (count + 1);
+    const size_t i = count++;
+    array[i].score = score (e);
+    array[i].idx = e;
+    pos[e] = (unsigned) i;
+    up (i);
+    down (pos[e]);
+    check ();
+  }
+
+  unsigned front () const {
+    assert (!empty ());
+    return array[0].idx;
+  }
+
+  unsigned pop_front () {
+    assert (!empty ());
+    const unsigned res = array[0].idx;
+    pos[res] = invalid_heap_position;
+    if (--count) {
+      place (0, array[count]);
+      if (count > 1)
+        down (0);
+    }
+    check ();
+    return res;
+  }
+
+  // Notify the heap, that the score of 'e' has changed.
+  //
+  void update (unsigned e) {
+    assert (contains (e));
+    const size_t i = pos[e];
+    array[i].score = score (e);
+    up (i);
+    down (pos[e]);
+    check ();
+  }
+
+  // All scores have been multiplied by 'factor' (which keeps the order).
+  //
+  void rescale (double factor) {
+    for (size_t i = 0; i < count; i++)
+      array[i].score *= factor;
+    check ();
+  }
+
+  void clear () {
+    count = 0;
+    pos.clear ();
+  }
+
+  void erase () {
+    erase_vector (storage);
+    erase_vector (pos);
+    array = 0;
+    count = 0;
+  }
+
+  void shrink () {
+    if (array)
+      reallocate (count);
+    shrink_vector (pos);
+  }
+};
 
 } // namespace CaDiCaL
 
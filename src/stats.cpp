@@ -155,12 +155,18 @@ void Stats::print (Internal *internal) {
          stats.elimites, percent (stats.elimites, stats.elimgates));
     PRT ("  elimxors:      %15" PRId64 "   %10.2f %%  xor gates",
          stats.elimxors, percent (stats.elimxors, stats.elimgates));
+    PRT ("  elimdefs:      %15" PRId64 "   %10.2f %%  definitions",
+         stats.elimdefs, percent (stats.elimdefs, stats.elimgates));
+    PRT ("  elimdefticks:  %15" PRId64 "   %10.2f    per definition",
+         stats.elimdefticks, relative (stats.elimdefticks, stats.elimdefs));
     PRT ("  elimsubst:     %15" PRId64 "   %10.2f %%  substituted",
          stats.elimsubst, percent (stats.elimsubst, stats.all.eliminated));
     PRT ("  elimres:       %15" PRId64 "   %10.2f    per eliminated",
          stats.elimres, relative (stats.elimres, stats.all.eliminated));
     PRT ("  elimrestried:  %15" PRId64 "   %10.2f %%  per resolution",
          stats.elimrestried, percent (stats.elimrestried, stats.elimres));
+    PRT ("  elimresreused: %15" PRId64 "   %10.2f %%  per resolution",
+         stats.elimresreused, percent (stats.elimresreused, stats.elimres));
   }
   if (all || stats.ext_prop.ext_cb) {
     PRT ("ext.prop. calls: %15" PRId64 "   %10.2f %%  of queries",
@@ -233,6 +239,18 @@ void Stats::print (Internal *internal) {
     PRT ("  flushings:     %15" PRId64 "   %10.2f    interval",
          stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  if (all || stats.gauss) {
+    PRT ("gauss:           %15" PRId64 "   %10.2f    interval", stats.gauss,
+         relative (stats.conflicts, stats.gauss));
+    PRT ("  gaussxors:     %15" PRId64 "   %10.2f    per phase",
+         stats.gaussxors, relative (stats.gaussxors, stats.gauss));
+    PRT ("  gaussunits:    %15" PRId64 "   %10.2f    per phase",
+         stats.gaussunits, relative (stats.gaussunits, stats.gauss));
+    PRT ("  gaussequivs:   %15" PRId64 "   %10.2f    per phase",
+         stats.gaussequivs, relative (stats.gaussequivs, stats.gauss));
+    PRT ("  gaussticks:    %15" PRId64 "   %10.2f    per phase",
+         stats.gaussticks, relative (stats.gaussticks, stats.gauss));
+  }
   if (all || stats.instantiated) {
     PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried",
          stats.instantiated, percent (stats.instantiated, stats.instried));
@@ -256,6 +274,20 @@ void Stats::print (Internal *internal) {
          stats.improvedglue,
          percent (stats.improvedglue, stats.learned.clauses));
   }
+  if (all || stats.learnhash.indexed) {
+    PRT ("learnhash:       %15" PRId64 "   %10.2f %%  per learned",
+         stats.learnhash.indexed,
+         percent (stats.learnhash.indexed, stats.learned.clauses));
+    PRT ("  searched:      %15" PRId64 "   %10.2f %%  per learned",
+         stats.learnhash.searched,
+         percent (stats.learnhash.searched, stats.learned.clauses));
+    PRT ("  reused:        %15" PRId64 "   %10.2f %%  per searched",
+         stats.learnhash.reused,
+         percent (stats.learnhash.reused, stats.learnhash.searched));
+    PRT ("  full:          %15" PRId64 "   %10.2f %%  per learned",
+         stats.learnhash.full,
+         percent (stats.learnhash.full, stats.learned.clauses));
+  }
   if (all || stats.lucky.succeeded) {
     PRT ("lucky:           %15" PRId64 "   %10.2f %%  of tried",
          stats.lucky.succeeded,
@@ -293,6 +325,9 @@ void Stats::print (Internal *internal) {
          percent (stats.learned.literals, stats.learned.literals));
   PRT ("minimized:       %15" PRId64 "   %10.2f %%  learned literals",
        stats.minimized, percent (stats.minimized, stats.learned.literals));
+  PRT ("minimizedbin:    %15" PRId64 "   %10.2f %%  learned literals",
+       stats.minimizedbin,
+       percent (stats.minimizedbin, stats.learned.literals));
   PRT ("shrunken:        %15" PRId64 "   %10.2f %%  learned literals",
        stats.shrunken, percent (stats.shrunken, stats.learned.literals));
   PRT ("minishrunken:    %15" PRId64 "   %10.2f %%  learned literals",
@@ -312,6 +347,14 @@ void Stats::print (Internal *internal) {
          percent (stats.otfs.strengthened, stats.conflicts));
   }
 
+  if (all || stats.prefetch.issued) {
+    PRT ("prefetched:      %15" PRId64 "   %10.2f    per propagation",
+         stats.prefetch.issued,
+         relative (stats.prefetch.issued, stats.propagations.search));
+    PRT ("  useful:        %15" PRId64 "   %10.2f %%  of prefetched",
+         stats.prefetch.useful,
+         percent (stats.prefetch.useful, stats.prefetch.issued));
+  }
   PRT ("propagations:    %15" PRId64 "   %10.2f M  per second",
        propagations, relative (propagations / 1e6, t));
   PRT ("  coverprops:    %15" PRId64 "   %10.2f %%  of propagations",
@@ -341,8 +384,18 @@ void Stats::print (Internal *internal) {
          stats.reduced, percent (stats.reduced, stats.conflicts));
     PRT ("  reductions:    %15" PRId64 "   %10.2f    interval",
          stats.reductions, relative (stats.conflicts, stats.reductions));
+    PRT ("  tiers:         %15" PRId64 "   %10.2f %%  of reductions",
+         stats.tiers, percent (stats.tiers, stats.reductions));
+    PRT ("  reducetime:    %15.2f   %10.2f ms per reduction",
+         stats.reducetime, relative (1e3 * stats.reducetime,
+                                     stats.reductions));
+    PRT ("  reducemax:     %15.2f   %10.2f %%  of reduce time",
+         stats.reducemax, percent (stats.reducemax, stats.reducetime));
     PRT ("  collections:   %15" PRId64 "   %10.2f    interval",
          stats.collections, relative (stats.conflicts, stats.collections));
+    PRT ("  minorcollects: %15" PRId64 "   %10.2f %%  of collections",
+         stats.minorcollections,
+         percent (stats.minorcollections, stats.collections));
   }
   if (all || stats.rephased.total) {
     PRT ("rephased:        %15" PRId64 "   %10.2f    interval",
@@ -397,6 +450,10 @@ void Stats::print (Internal *internal) {
     PRT ("  reusedstab:    %15" PRId64 "   %10.2f %%  per stable restarts",
          stats.reusedstable,
          percent (stats.reusedstable, stats.restartstable));
+    PRT ("  chbphases:     %15" PRId64 "   %10.2f %%  of stable phases",
+         stats.chb.phases, percent (stats.chb.phases, stats.stabphases));
+    PRT ("  chbbumped:     %15" PRId64 "   %10.2f    per CHB phase",
+         stats.chb.bumped, relative (stats.chb.bumped, stats.chb.phases));
   }
   if (all || stats.all.substituted) {
     PRT ("substituted:     %15" PRId64 "   %10.2f %%  of all variables",
@@ -431,6 +488,8 @@ void Stats::print (Internal *internal) {
          stats.subchecks, relative (stats.subchecks, stats.subtried));
     PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck",
          stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+    PRT ("  subfiltered:   %15" PRId64 "   %10.2f    per subcheck",
+         stats.subfiltered, relative (stats.subfiltered, stats.subchecks));
     PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed",
          stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
     PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed",
@@ -460,6 +519,37 @@ void Stats::print (Internal *internal) {
     PRT ("  htr2:          %15" PRId64 "   %10.2f %%  binary hyper ternres",
          stats.htrs2, percent (stats.htrs2, stats.htrs));
   }
+  if (all || stats.tombstones.buried || stats.tombstones.delayed) {
+    PRT ("tombstones:      %15" PRId64 "   %10.2f    per conflict",
+         stats.tombstones.buried,
+         relative (stats.tombstones.buried, stats.conflicts));
+    PRT ("  delayed:       %15" PRId64 "   %10.2f    per decomposition",
+         stats.tombstones.delayed,
+         relative (stats.tombstones.delayed, stats.decompositions));
+    PRT ("  skipped:       %15" PRId64 "   %10.2f %%  of tombstones",
+         stats.tombstones.skipped,
+         percent (stats.tombstones.skipped, stats.tombstones.buried));
+    PRT ("  flushed:       %15" PRId64 "   %10.2f %%  of tombstones",
+         stats.tombstones.flushed,
+         percent (stats.tombstones.flushed, stats.tombstones.buried));
+  }
+  if (all || stats.trailsave.saved) {
+    PRT ("trailsaved:      %15" PRId64 "   %10.2f    per conflict",
+         stats.trailsave.saved,
+         relative (stats.trailsave.saved, stats.conflicts));
+    PRT ("  replayed:      %15" PRId64 "   %10.2f %%  of saved",
+         stats.trailsave.replayed,
+         percent (stats.trailsave.replayed, stats.trailsave.saved));
+    PRT ("  repropagated:  %15" PRId64 "   %10.2f %%  of saved",
+         stats.trailsave.repropagated,
+         percent (stats.trailsave.repropagated, stats.trailsave.saved));
+    PRT ("  conflicts:     %15" PRId64 "   %10.2f %%  of conflicts",
+         stats.trailsave.conflicts,
+         percent (stats.trailsave.conflicts, stats.conflicts));
+    PRT ("  invalid:       %15" PRId64 "   %10.2f %%  of saved",
+         stats.trailsave.invalid,
+         percent (stats.trailsave.invalid, stats.trailsave.saved));
+  }
   if (all || stats.ilbtriggers) {
     PRT ("trail reuses:    %15" PRId64 "   %10.2f %%  of incremental calls",
          stats.ilbsuccess, percent (stats.ilbsuccess, stats.ilbtriggers));
@@ -558,6 +648,17 @@ void Internal::print_resource_usage () {
        internal->real_time ());
   MSG ("maximum resident set size of process:    %12.2f    MB",
        m / (double) (1l << 20));
+  if (opts.hugepages) {
+    const size_t a = arena.huge_bytes (), t = huge_tables_bytes ();
+    const uint64_t c = current_resident_set_size ();
+    const uint64_t h = huge_pages_resident_set_size ();
+    MSG ("arena memory advised to use huge pages:  %12.2f    MB",
+         a / (double) (1l << 20));
+    MSG ("table memory advised to use huge pages:  %12.2f    MB",
+         t / (double) (1l << 20));
+    MSG ("huge pages of current resident set size: %12.2f    %%",
+         percent (h, c));
+  }
 #endif
 }
 
@@ -26,6 +26,18 @@ struct Stats {
     int64_t walk;        // propagated during local search
   } propagations;
 
+  struct {
+    int64_t issued; // prefetched clauses of watches in 'propagate'
+    int64_t useful; // prefetched clauses actually visited afterwards
+  } prefetch;
+
+  struct {
+    int64_t buried;  // lazily removed watches (thus avoided list scans)
+    int64_t delayed; // lazily updated watches of new binary clauses
+    int64_t skipped; // tombstones dropped during propagation
+    int64_t flushed; // tombstones dropped in 'flush_tombstones'
+  } tombstones;
+
   struct {
     int64_t ext_cb;     // number of times any external callback was called
     int64_t eprop_call; // number of times external_propagate was called
@@ -121,6 +133,10 @@ struct Stats {
   int64_t restartstable;  // actual number of happened restarts
   int64_t stabphases;     // number of stabilization phases
   int64_t stabconflicts;  // number of search conflicts during stabilizing
+  struct {
+    int64_t phases; // stable phases with CHB scores
+    int64_t bumped; // CHB score updates
+  } chb;
   int64_t rescored;       // number of times scores were rescored
   int64_t reused;         // number of reused trails
   int64_t reusedlevels;   // reused levels at restart
@@ -136,8 +152,12 @@ struct Stats {
   int64_t searched;       // searched decisions in 'decide'
   int64_t reductions;     // 'reduce' counter
   int64_t reduced;        // number of reduced clauses
+  int64_t tiers;          // recomputed tier boundaries
+  double reducetime;      // time spent in 'reduce'
+  double reducemax;       // maximum time of one 'reduce'
   int64_t collected;      // number of collected bytes
   int64_t collections;    // number of garbage collections
+  int64_t minorcollections; // number of minor (generational) collections
   int64_t hbrs;           // hyper binary resolvents
   int64_t hbrsizes;       // sum of hyper resolved base clauses
   int64_t hbreds;         // redundant hyper binary resolvents
@@ -156,6 +176,7 @@ struct Stats {
   int64_t subtried;  // number of tried subsumptions
   int64_t subchecks; // number of pair-wise subsumption checks
   int64_t subchecks2;    // same but restricted to binary clauses
+  int64_t subfiltered;   // candidates rejected by clause signatures
   int64_t elimotfsub;    // number of on-the-fly subsumed during elimination
   int64_t subsumerounds; // number of subsumption rounds
   int64_t subsumephases; // number of scheduled subsumption phases
@@ -163,6 +184,7 @@ struct Stats {
   int64_t eagersub; // number of eagerly subsumed recently learned clauses
   int64_t elimres;  // number of resolved clauses in BVE
   int64_t elimrestried;   // number of tried resolved clauses in BVE
+  int64_t elimresreused;  // number of resolvents added without resolving
   int64_t elimrounds;     // number of elimination rounds
   int64_t elimphases;     // number of scheduled elimination phases
   int64_t elimcompleted;  // number complete elimination procedures
@@ -173,6 +195,8 @@ struct Stats {
   int64_t elimands;       // number of AND gates found during elimination
   int64_t elimites;       // number of ITE gates found during elimination
   int64_t elimxors;       // number of XOR gates found during elimination
+  int64_t elimdefs;       // number of definitions found during elimination
+  int64_t elimdefticks;   // ticks of the definition solver
   int64_t elimbwsub;      // number of eager backward subsumed clauses
   int64_t elimbwstr;      // number of eager backward strengthened clauses
   int64_t ternary;        // number of ternary resolution phases
@@ -180,6 +204,11 @@ struct Stats {
   int64_t htrs;           // number of hyper ternary resolvents
   int64_t htrs2;          // number of binary hyper ternary resolvents
   int64_t htrs3;          // number of ternary hyper ternary resolvents
+  int64_t gauss;          // number of Gaussian elimination phases
+  int64_t gaussxors;      // number of extracted XOR constraints
+  int64_t gaussticks;     // ticks of Gaussian elimination
+  int64_t gaussunits;     // units found by Gaussian elimination
+  int64_t gaussequivs;    // equivalences found by Gaussian elimination
   int64_t decompositions; // number of SCC + ELS
   int64_t vivifications;  // number of vivifications
   int64_t vivifychecks;   // checked clauses during vivification
@@ -200,7 +229,21 @@ struct Stats {
     int64_t literals;
     int64_t clauses;
   } learned;
+  struct {
+    int64_t indexed;  // learned clauses added to the hash index
+    int64_t searched; // lookups of learned clauses in non-empty index
+    int64_t reused;   // identical learned clauses reused
+    int64_t full;     // learned clauses not indexed due to memory limit
+  } learnhash;
+  struct {
+    int64_t saved;        // literals saved during backjumps
+    int64_t replayed;     // saved literals assigned with saved reason
+    int64_t repropagated; // saved literals propagated before replaying
+    int64_t conflicts;    // conflicts found while replaying
+    int64_t invalid;      // replaying stopped due to changed reason
+  } trailsave;
   int64_t minimized;    // minimized literals
+  int64_t minimizedbin; // minimized through binary implications
   int64_t shrunken;     // shrunken literals
   int64_t minishrunken; // shrunken during minimization literals
 
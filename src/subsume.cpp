@@ -8,8 +8,8 @@ namespace CaDiCaL {
 // frequently during search.  It works both on original (irredundant)
 // clauses and on 'sticky' learned clauses which are likely to be kept.
 // This is abstracted away in the 'likely_to_be_kept_clause' function, which
-// implicitly relies on 'opts.reducetier1glue' (glucose level of clauses
-// which are not reduced) as well as dynamically determined size and glucose
+// implicitly relies on 'lim.tier1glue' (glucose level of clauses which are
+// not reduced) as well as dynamically determined size and glucose
 // level ('lim.keptglue' and 'lim.keptsize') of clauses kept in 'reduce'.
 //
 // Note, that 'forward' means that the clause from which the subsumption
@@ -142,6 +142,24 @@ inline int Internal::subsume_check (Clause *subsuming, Clause *subsumed) {
 
 /*------------------------------------------------------------------------*/
 
+// The signature of a clause is a 64-bit Bloom filter of its variables (and
+// not its literals, since a strengthening clause contains one literal in
+// opposite phase).  If a clause 'subsuming' subsumes or strengthens a clause
+// 'subsumed' then all the bits of its signature are also set in the
+// signature of 'subsumed'.  Thus most non-subsuming pairs are rejected by
+// 'sig(subsuming) & ~sig(subsumed)' without accessing the clause
+// 'subsuming' at all.  Removing literals from a clause keeps its old
+// signature a valid over-approximation.
+
+uint64_t Internal::clause_signature (Clause *c) {
+  uint64_t res = 0;
+  for (const auto &lit : *c)
+    res |= signature_bit (lit);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Candidate clause 'subsumed' is subsumed by 'subsuming'.
 
 inline void Internal::subsume_clause (Clause *subsuming, Clause *subsumed) {
@@ -159,7 +177,7 @@ inline void Internal::subsume_clause (Clause *subsuming, Clause *subsumed) {
   LOG ("turning redundant subsuming clause into irredundant clause");
   subsuming->redundant = false;
   if (proof)
-    proof->strengthen (subsuming->id);
+    proof->strengthen (subsuming->id ());
   mark_garbage (subsumed);
   stats.current.irredundant++;
   stats.added.irredundant++;
@@ -194,13 +212,15 @@ void Internal::strengthen_clause (Clause *c, int lit) {
 
 /*------------------------------------------------------------------------*/
 
-// Find clauses connected in the occurrence lists 'occs' which subsume the
-// candidate clause 'c' given as first argument.  If this is the case the
-// clause is subsumed and the result is positive.   If the clause was
-// strengthened the result is negative.  Otherwise the candidate clause
-// can not be subsumed nor strengthened and zero is returned.
+// Find clauses connected in the occurrence lists 'sotab' which subsume the
+// candidate clause 'c' given as first argument with the given 'signature'.
+// If this is the case the clause is subsumed and the result is positive.
+// If the clause was strengthened the result is negative.  Otherwise the
+// candidate clause can not be subsumed nor strengthened and zero is
+// returned.
 
-inline int Internal::try_to_subsume_clause (Clause *c,
+inline int Internal::try_to_subsume_clause (Clause *c, uint64_t signature,
+                                            vector<SigOccs> &sotab,
                                             vector<Clause *> &shrunken) {
 
   stats.subtried++;
@@ -264,7 +284,7 @@ inline int Internal::try_to_subsume_clause (Clause *c,
         // well as the code around 'strengthen_clause' uniform for both real
         // clauses and this special case for binary clauses
 
-        dummy_binary->id = bin.id;
+        dummy_binary->set_id (bin.id);
         d = dummy_binary;
 
         break;
@@ -275,12 +295,18 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
       // In this second loop we check for larger than binary clauses to
       // subsume or strengthen the candidate clause.   This is more costly,
-      // and needs a call to 'subsume_check'.  Otherwise the same contract
-      // as above for communicating 'subsumption' or 'strengthening' to the
-      // code after the loop is used.
+      // and needs a call to 'subsume_check' unless the signature already
+      // rules it out.  Otherwise the same contract as above for
+      // communicating 'subsumption' or 'strengthening' to the code after
+      // the loop is used.
       //
-      const Occs &os = occs (sign * lit);
-      for (const auto &e : os) {
+      const SigOccs &os = sotab[vlit (sign * lit)];
+      for (const auto &o : os) {
+        if (o.signature & ~signature) {
+          stats.subfiltered++;
+          continue;
+        }
+        Clause *e = o.clause;
         assert (!e->garbage); // sanity check
         if (e->garbage)
           continue; // defensive: not needed
@@ -308,8 +334,8 @@ inline int Internal::try_to_subsume_clause (Clause *c,
     LOG (d, "strengthening");
     if (lrat) {
       assert (lrat_chain.empty ());
-      lrat_chain.push_back (c->id);
-      lrat_chain.push_back (d->id);
+      lrat_chain.push_back (c->id ());
+      lrat_chain.push_back (d->id ());
     }
     strengthen_clause (c, -flipped);
     lrat_chain.clear ();
@@ -325,12 +351,15 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
 // Sorting the scheduled clauses is way faster if we compute and save the
 // clause size in the schedule to avoid pointer access to clauses during
-// sorting.  This slightly increases the schedule size though.
+// sorting.  This slightly increases the schedule size though.  The
+// signature is computed while scanning the clause during scheduling.
 
 struct ClauseSize {
   size_t size;
+  uint64_t signature;
   Clause *clause;
-  ClauseSize (int s, Clause *c) : size (s), clause (c) {}
+  ClauseSize (int s, uint64_t g, Clause *c)
+      : size (s), signature (g), clause (c) {}
   ClauseSize () {}
 };
 
@@ -427,11 +456,14 @@ bool Internal::subsume_round () {
 
     bool fixed = false;
     int subsume = 0;
-    for (const auto &lit : *c)
+    uint64_t signature = 0;
+    for (const auto &lit : *c) {
       if (val (lit))
         fixed = true;
       else if (flags (lit).subsume)
         subsume++;
+      signature |= signature_bit (lit);
+    }
 
     // If the clause contains a root level assigned (fixed) literal we will
     // not work on it.  This simplifies the code substantially since we do
@@ -453,7 +485,7 @@ bool Internal::subsume_round () {
 
     if (c->subsume)
       left_over_from_last_subsumption_round++;
-    schedule.push_back (ClauseSize (c->size, c));
+    schedule.push_back (ClauseSize (c->size, signature, c));
     for (const auto &lit : *c)
       noccs (lit)++;
   }
@@ -486,7 +518,7 @@ bool Internal::subsume_round () {
   int64_t subsumed = 0, strengthened = 0, checked = 0;
 
   vector<Clause *> shrunken;
-  init_occs ();
+  vector<SigOccs> sotab (2 * vsize);
   init_bins ();
 
   for (const auto &s : schedule) {
@@ -497,6 +529,7 @@ bool Internal::subsume_round () {
       break;
 
     Clause *c = s.clause;
+    uint64_t signature = s.signature;
     assert (!c->garbage);
 
     checked++;
@@ -511,13 +544,15 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      const int tmp = try_to_subsume_clause (c, signature, sotab, shrunken);
       if (tmp > 0) {
         subsumed++;
         continue;
       }
-      if (tmp < 0)
+      if (tmp < 0) {
+        signature = clause_signature (c);
         strengthened++;
+      }
     }
 
     // If not subsumed connect smallest occurring literal, where occurring
@@ -537,7 +572,8 @@ bool Internal::subsume_round () {
 
       if (!flags (lit).subsume)
         subsume = false;
-      const size_t size = binary ? bins (lit).size () : occs (lit).size ();
+      const size_t size =
+          binary ? bins (lit).size () : sotab[vlit (lit)].size ();
       if (minlit && minsize <= size)
         continue;
       const int64_t tmp = noccs (lit);
@@ -565,7 +601,7 @@ bool Internal::subsume_round () {
            "watching %d with %zd current and total %" PRId64 " occurrences",
            minlit, minsize, minoccs);
 
-      occs (minlit).push_back (c);
+      sotab[vlit (minlit)].push_back (SigOcc{signature, c});
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -592,7 +628,7 @@ bool Internal::subsume_round () {
 
       const int minlit_pos = (c->literals[1] == minlit);
       const int other = c->literals[!minlit_pos];
-      bins (minlit).push_back (Bin{other, c->id});
+      bins (minlit).push_back (Bin{other, c->id ()});
     }
   }
 
@@ -617,8 +653,8 @@ bool Internal::subsume_round () {
   // Release occurrence lists and schedule.
   //
   erase_vector (schedule);
+  erase_vector (sotab);
   reset_noccs ();
-  reset_occs ();
   reset_bins ();
 
   // Reset all old 'added' flags and mark variables in shrunken
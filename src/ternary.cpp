@@ -193,8 +193,8 @@ void Internal::ternary_lit (int pivot, int64_t &steps, int64_t &htrs) {
         bool red = (size == 3 || (c->redundant && d->redundant));
         if (lrat) {
           assert (lrat_chain.empty ());
-          lrat_chain.push_back (c->id);
-          lrat_chain.push_back (d->id);
+          lrat_chain.push_back (c->id ());
+          lrat_chain.push_back (d->id ());
         }
         Clause *r = new_hyper_ternary_resolved_clause (red);
         if (red)
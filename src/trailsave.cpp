@@ -0,0 +1,116 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Trail saving following Hickey and Bacchus [SAT'20].  After a conflict
+// the backjump in 'analyze' unassigns all literals above the jump level,
+// even though most of them are implied again right after the next few
+// decisions.  If enabled by 'opts.trailsave' the unassigned part of the
+// trail is saved together with the reasons of the literals in trail order
+// (decisions have a zero reason).
+
+// The saved trail consists of segments, each starting with a saved
+// decision followed by the literals implied at its decision level.  The
+// saved decisions are indexed by their variables in 'saved_positions'.
+// When propagation reaches a literal which is a saved decision (checked in
+// 'propagate' before propagating the literal), no matter whether it was
+// assigned again as decision or implied at another level, the saved
+// implied literals of its segment are assigned directly with their saved
+// reasons.  They are still propagated afterwards as usual, but are thus
+// assigned early without traversing watches to find their reason, and a
+// conflict is found as soon as one of them is already falsified.  Each
+// segment is replayed at most once.
+
+// The saved reasons are not watched and may have been changed in the mean
+// time.  Thus before replaying a literal its reason is checked to be a
+// non-garbage clause containing the literal with all other literals false.
+// If this check fails replaying the segment stops.  The saved trail is
+// dropped during garbage collection, since saved reasons might be deleted
+// or moved (and variables renamed in 'compact').
+
+void Internal::save_trail (int new_level) {
+  if (!opts.trailsave || external_prop)
+    return;
+  clear_saved_trail ();
+  if (new_level >= level)
+    return;
+  const size_t start = control[new_level + 1].trail;
+  for (size_t i = start; i < trail.size (); i++) {
+    const int lit = trail[i];
+    const Var &v = var (lit);
+    if (v.level <= new_level)
+      continue; // Out-of-order literal kept on the trail.
+    if (!v.reason)
+      saved_positions[vidx (lit)] = saved_trail.size () + 1;
+    saved_trail.push_back (lit);
+    saved_reasons.push_back (v.reason);
+  }
+  stats.trailsave.saved += saved_trail.size ();
+  LOG ("saved %zd trail literals above level %d", saved_trail.size (),
+       new_level);
+}
+
+void Internal::clear_saved_trail () {
+  for (const auto &lit : saved_trail)
+    saved_positions[vidx (lit)] = 0;
+  saved_trail.clear ();
+  saved_reasons.clear ();
+}
+
+// Check that the saved 'reason' still forces 'lit'.
+
+bool Internal::saved_reason_forces (int lit, Clause *reason) {
+  if (reason->garbage)
+    return false;
+  bool found = false;
+  for (const auto &other : *reason) {
+    if (other == lit)
+      found = true;
+    else if (val (other) >= 0)
+      return false;
+  }
+  return found;
+}
+
+// Called from 'propagate' if the saved decision 'saved_trail[pos]' is
+// assigned again.  Replays the implied literals of its segment.
+
+void Internal::replay_saved_trail (size_t pos) {
+  assert (level > 0);
+  assert (pos < saved_trail.size ());
+  assert (!saved_reasons[pos]);
+  assert (val (saved_trail[pos]) > 0);
+  assert (!conflict);
+  const int decision = saved_trail[pos];
+  LOG ("replaying saved trail segment of decision %d", decision);
+  saved_positions[vidx (decision)] = 0;
+  const size_t size = saved_trail.size ();
+  while (++pos < size) {
+    Clause *reason = saved_reasons[pos];
+    if (!reason)
+      break; // Next saved decision.
+    const int lit = saved_trail[pos];
+    const signed char tmp = val (lit);
+    if (tmp > 0) {
+      stats.trailsave.repropagated++;
+      continue;
+    }
+    if (!active (lit) || !saved_reason_forces (lit, reason)) {
+      LOG (reason, "saved reason does not force %d any more", lit);
+      stats.trailsave.invalid++;
+      break;
+    }
+    if (tmp < 0) {
+      LOG (reason, "saved reason of %d in conflict", lit);
+      stats.trailsave.conflicts++;
+      conflict = reason;
+      break;
+    }
+    search_assign_driving (lit, reason);
+    stats.trailsave.replayed++;
+  }
+}
+
+} // namespace CaDiCaL
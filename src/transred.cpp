@@ -152,7 +152,7 @@ void Internal::transred () {
         const Watch &w = *k;
         if (!w.binary ())
           break; // since we sorted watches above
-        Clause *d = w.clause;
+        Clause *d = watched_clause (w);
         if (d == c)
           continue;
         if (irredundant && d->redundant)
@@ -169,7 +169,7 @@ void Internal::transred () {
           else if (tmp < 0) {
             if (lrat) {
               parents.push_back (lit);
-              mini_chain.push_back (d->id);
+              mini_chain.push_back (d->id ());
               work.push_back (other);
             }
             LOG ("found both %d and %d reachable", -other, other);
@@ -177,7 +177,7 @@ void Internal::transred () {
           } else {
             if (lrat) {
               parents.push_back (lit);
-              mini_chain.push_back (d->id);
+              mini_chain.push_back (d->id ());
             }
             mark (other);
             work.push_back (other);
@@ -1,12 +1,22 @@
 #ifndef _var_hpp_INCLUDED
 #define _var_hpp_INCLUDED
 
+#ifdef PACKEDVARS
+#include "flags.hpp"
+#endif
+
 namespace CaDiCaL {
 
 struct Clause;
 
 // This structure captures data associated with an assigned variable.
 
+// If compiled with '-DPACKEDVARS' (configured '--packed-vars') the flags of
+// a variable (including 'seen') are stored in the same record too, instead
+// of the separate 'ftab' table.  Then conflict analysis only touches one
+// cache line per variable.  Values are only kept in the literal indexed
+// 'vals' table, which is much smaller and used by propagation.
+
 struct Var {
 
   // Note that none of these members is valid unless the variable is
@@ -15,6 +25,10 @@ struct Var {
   int level;      // decision level
   int trail;      // trail height at assignment
   Clause *reason; // implication graph edge during search
+
+#ifdef PACKEDVARS
+  Flags flags; // always valid (replaces the 'ftab' entry)
+#endif
 };
 
 } // namespace CaDiCaL
@@ -83,6 +83,11 @@ void Internal::vivify_assume (int lit) {
 // 'probe_propagate' with 'probe_propagate2' in 'probe.cpp'.  Please refer
 // to that code for more explanation on how propagation is implemented.
 
+// Since binary watches are kept in front of the watch lists (see
+// 'watch_literal') the binary clause propagation loop stops at the first
+// large clause watch and the large clause loop starts after the binary
+// prefix, instead of both skipping over the watches of the other kind.
+
 bool Internal::vivify_propagate () {
   require_mode (VIVIFY);
   assert (!unsat);
@@ -95,15 +100,16 @@ bool Internal::vivify_propagate () {
       Watches &ws = watches (lit);
       for (const auto &w : ws) {
         if (!w.binary ())
-          continue;
+          break;
         const signed char b = val (w.blit);
         if (b > 0)
           continue;
+        Clause *c = watched_clause (w);
         if (b < 0)
-          conflict = w.clause; // but continue
+          conflict = c; // but continue
         else {
-          build_chain_for_units (w.blit, w.clause, 0);
-          vivify_assign (w.blit, w.clause);
+          build_chain_for_units (w.blit, c, 0);
+          vivify_assign (w.blit, c);
           lrat_chain.clear ();
         }
       }
@@ -114,27 +120,30 @@ bool Internal::vivify_propagate () {
       const const_watch_iterator eow = ws.end ();
       const_watch_iterator i = ws.begin ();
       watch_iterator j = ws.begin ();
+      while (i != eow && i->binary ())
+        i++, j++;
       while (i != eow) {
         const Watch w = *j++ = *i++;
         if (w.binary ())
           continue;
         if (val (w.blit) > 0)
           continue;
-        if (w.clause->garbage) {
+        Clause *c = watched_clause (w);
+        if (c->garbage) {
           j--;
           continue;
         }
-        if (w.clause == ignore)
+        if (c == ignore)
           continue;
-        literal_iterator lits = w.clause->begin ();
+        literal_iterator lits = c->begin ();
         const int other = lits[0] ^ lits[1] ^ lit;
         const signed char u = val (other);
         if (u > 0)
           j[-1].blit = other;
         else {
-          const int size = w.clause->size;
+          const int size = c->size;
           const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
+          const literal_iterator middle = lits + c->pos;
           literal_iterator k = middle;
           signed char v = -1;
           int r = 0;
@@ -142,30 +151,30 @@ bool Internal::vivify_propagate () {
             k++;
           if (v < 0) {
             k = lits + 2;
-            assert (w.clause->pos <= size);
+            assert (c->pos <= size);
             while (k != middle && (v = val (r = *k)) < 0)
               k++;
           }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
+          c->pos = k - lits;
+          assert (lits + 2 <= k), assert (k <= c->end ());
           if (v > 0)
             j[-1].blit = r;
           else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
+            LOG (c, "unwatch %d in", r);
             lits[0] = other;
             lits[1] = r;
             *k = lit;
-            watch_literal (r, lit, w.clause);
+            watch_literal (r, lit, w);
             j--;
           } else if (!u) {
             assert (v < 0);
-            vivify_chain_for_units (other, w.clause);
-            vivify_assign (other, w.clause);
+            vivify_chain_for_units (other, c);
+            vivify_assign (other, c);
             lrat_chain.clear ();
           } else {
             assert (u < 0);
             assert (v < 0);
-            conflict = w.clause;
+            conflict = c;
             break;
           }
         }
@@ -1051,7 +1060,7 @@ void Internal::vivify_build_lrat (
       continue;
     }
     if (finished) {
-      lrat_chain.push_back (reason->id);
+      lrat_chain.push_back (reason->id ());
       if (lit && reason) {
         Flags &f = flags (lit);
         f.seen = true;
@@ -1108,7 +1117,7 @@ inline void Internal::vivify_chain_for_units (int lit, Clause *reason) {
     uint64_t id = unit_clauses[uidx];
     lrat_chain.push_back (id);
   }
-  lrat_chain.push_back (reason->id);
+  lrat_chain.push_back (reason->id ());
 }
 
 /*------------------------------------------------------------------------*/
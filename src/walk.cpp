@@ -6,20 +6,46 @@ namespace CaDiCaL {
 
 // Random walk local search based on 'ProbSAT' ideas.
 
+// In earlier versions break values were computed on demand by traversing
+// the watches of the literal in a one-watch scheme.  Now the walker keeps
+// for each considered clause the number of true literals and the 'xor' of
+// all its true literals, which is the single true ('critical') literal if
+// exactly one literal is true.  This allows to maintain the break count of
+// every variable (the number of clauses in which its true literal is the
+// only true literal) incrementally while flipping, by traversing the
+// occurrences of the flipped variable, and picking a literal in a broken
+// clause only needs to look up the break counts of its literals.
+
 struct Walker {
 
   Internal *internal;
 
-  Random random;           // local random number generator
-  int64_t propagations;    // number of propagations
-  int64_t limit;           // limit on number of propagations
-  vector<Clause *> broken; // currently unsatisfied clauses
-  double epsilon;          // smallest considered score
-  vector<double> table;    // break value to score table
-  vector<double> scores;   // scores of candidate literals
+  Random random;              // local random number generator
+  int64_t propagations;       // number of propagations
+  int64_t limit;              // limit on number of propagations
+  vector<Clause *> clauses;   // considered clauses
+  vector<unsigned> satisfied; // number of true literals per clause
+  vector<int> critical;       // 'xor' of true literals per clause
+  vector<unsigned> broken;    // currently unsatisfied clauses
+  vector<unsigned> position;  // position of clauses in 'broken'
+  vector<unsigned> breaks;    // break counts of variables
+  vector<unsigned> offsets;   // start of literal occurrences in 'occs'
+  vector<unsigned> occs;      // clauses ordered by their literals
+  double epsilon;             // smallest considered score
+  vector<double> table;       // break value to score table
+  vector<double> scores;      // scores of candidate literals
+
+  static const unsigned invalid_position = UINT_MAX;
+
+  static unsigned code (int lit) {
+    return 2u * (unsigned) abs (lit) + (lit < 0);
+  }
 
   double score (unsigned); // compute score from break count
 
+  void make (unsigned);  // remove satisfied clause from 'broken'
+  void brake (unsigned); // add unsatisfied clause to 'broken'
+
   Walker (Internal *, double size, int64_t limit);
 };
 
@@ -91,6 +117,23 @@ inline double Walker::score (unsigned i) {
   return res;
 }
 
+inline void Walker::make (unsigned i) {
+  const unsigned pos = position[i];
+  assert (pos < broken.size ());
+  assert (broken[pos] == i);
+  const unsigned last = broken.back ();
+  broken[pos] = last;
+  position[last] = pos;
+  broken.pop_back ();
+  position[i] = invalid_position;
+}
+
+inline void Walker::brake (unsigned i) {
+  assert (position[i] == invalid_position);
+  position[i] = broken.size ();
+  broken.push_back (i);
+}
+
 /*------------------------------------------------------------------------*/
 
 Clause *Internal::walk_pick_clause (Walker &walker) {
@@ -100,79 +143,13 @@ Clause *Internal::walk_pick_clause (Walker &walker) {
   if (size > INT_MAX)
     size = INT_MAX;
   int pos = walker.random.pick_int (0, size - 1);
-  Clause *res = walker.broken[pos];
+  Clause *res = walker.clauses[walker.broken[pos]];
   LOG (res, "picking random position %d", pos);
   return res;
 }
 
 /*------------------------------------------------------------------------*/
 
-// Compute the number of clauses which would be become unsatisfied if 'lit'
-// is flipped and set to false.  This is called the 'break-count' of 'lit'.
-
-unsigned Internal::walk_break_value (int lit) {
-
-  require_mode (WALK);
-  assert (val (lit) > 0);
-
-  unsigned res = 0; // The computed break-count of 'lit'.
-
-  for (auto &w : watches (lit)) {
-    assert (w.blit != lit);
-    if (val (w.blit) > 0)
-      continue;
-    if (w.binary ()) {
-      res++;
-      continue;
-    }
-
-    Clause *c = w.clause;
-    assert (lit == c->literals[0]);
-
-    // Now try to find a second satisfied literal starting at 'literals[1]'
-    // shifting all the traversed literals to right by one position in order
-    // to move such a second satisfying literal to 'literals[1]'.  This move
-    // to front strategy improves the chances to find the second satisfying
-    // literal earlier in subsequent break-count computations.
-    //
-    auto begin = c->begin () + 1;
-    const auto end = c->end ();
-    auto i = begin;
-    int prev = 0;
-    while (i != end) {
-      const int other = *i;
-      *i++ = prev;
-      prev = other;
-      if (val (other) < 0)
-        continue;
-
-      // Found 'other' as second satisfying literal.
-
-      w.blit = other; // Update 'blit'
-      *begin = other; // and move to front.
-
-      break;
-    }
-
-    if (i != end)
-      continue; // Double satisfied!
-
-    // Otherwise restore literals (undo shift to the right).
-    //
-    while (i != begin) {
-      const int other = *--i;
-      *i = prev;
-      prev = other;
-    }
-
-    res++; // Literal 'lit' single satisfies clause 'c'.
-  }
-
-  return res;
-}
-
-/*------------------------------------------------------------------------*/
-
 // Given an unsatisfied clause 'c', in which we want to flip a literal, we
 // first determine the exponential score based on the break-count of its
 // literals and then sample the literals based on these scores.  The CB
@@ -188,16 +165,14 @@ int Internal::walk_pick_lit (Walker &walker, Clause *c) {
   LOG ("picking literal by break-count");
   assert (walker.scores.empty ());
   double sum = 0;
-  int64_t propagations = 0;
   for (const auto lit : *c) {
     assert (active (lit));
     if (var (lit).level == 1) {
       LOG ("skipping assumption %d for scoring", -lit);
       continue;
     }
-    assert (active (lit));
-    propagations++;
-    unsigned tmp = walk_break_value (-lit);
+    assert (val (lit) < 0);
+    unsigned tmp = walker.breaks[vidx (lit)];
     double score = walker.score (tmp);
     LOG ("literal %d break-count %u score %g", lit, tmp, score);
     walker.scores.push_back (score);
@@ -205,8 +180,6 @@ int Internal::walk_pick_lit (Walker &walker, Clause *c) {
   }
   LOG ("scored %zd literals", walker.scores.size ());
   assert (!walker.scores.empty ());
-  walker.propagations += propagations;
-  stats.propagations.walk += propagations;
   assert (walker.scores.size () <= (size_t) c->size);
   const double lim = sum * walker.random.generate_double ();
   LOG ("score sum %g limit %g", sum, lim);
@@ -250,138 +223,79 @@ void Internal::walk_flip_lit (Walker &walker, int lit) {
   set_val (idx, tmp);
   assert (val (lit) > 0);
 
-  // Then remove 'c' and all other now satisfied (made) clauses.
+  const unsigned *occs = walker.occs.data ();
+  const unsigned *offsets = walker.offsets.data ();
+
+  // Every traversed occurrence of 'lit' and '-lit' below visits a clause
+  // and is counted as one propagation (as each visited clause during break
+  // value computation before), plus one for picking the literal.
+  //
+  {
+    const unsigned pos = Walker::code (lit), neg = Walker::code (-lit);
+    const int64_t visited = offsets[pos + 1] - offsets[pos] +
+                            offsets[neg + 1] - offsets[neg] + 1;
+    walker.propagations += visited;
+    stats.propagations.walk += visited;
+  }
+
+  // Then update the clauses containing 'lit', which are made (satisfied)
+  // or have one more true literal now.
   {
-    // Simply go over all unsatisfied (broken) clauses.
-
-    LOG ("trying to make %zd broken clauses", walker.broken.size ());
-
-    // We need to measure (and bound) the memory accesses during traversing
-    // broken clauses in terms of 'propagations'. This is tricky since we
-    // are not actually propagating literals.  Instead we use the clause
-    // variable 'ratio' as an approximation to the number of clauses used
-    // during propagating a literal.  Note that we use a one-watch scheme.
-    // Accordingly the number of broken clauses traversed divided by that
-    // ratio is an approximation of the number of propagation this would
-    // correspond to (in terms of memory access).  To eagerly update these
-    // statistics we simply increment the propagation counter after every
-    // 'ratio' traversed clause.  These propagations are particularly
-    // expensive if the number of broken clauses is large which usually
-    // happens initially.
-    //
-    const double ratio = clause_variable_ratio ();
-    const auto eou = walker.broken.end ();
-    auto j = walker.broken.begin (), i = j;
 #ifdef LOGGING
     int64_t made = 0;
 #endif
-    int64_t count = 0;
-
-    while (i != eou) {
-
-      Clause *d = *j++ = *i++;
-
-      int *literals = d->literals, prev = 0;
-
-      // Find 'lit' in 'd'.
-      //
-      const int size = d->size;
-      for (int i = 0; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev;
-        prev = other;
-        if (other == lit)
-          break;
-        assert (val (other) < 0);
-      }
-
-      // If 'lit' is in 'd' then move it to the front to watch it.
-      //
-      if (prev == lit) {
-        literals[0] = lit;
-        LOG (d, "made");
-        watch_literal (literals[0], literals[1], d);
+    const unsigned code = Walker::code (lit);
+    const unsigned *const end = occs + offsets[code + 1];
+    for (const unsigned *p = occs + offsets[code]; p != end; p++) {
+      const unsigned i = *p;
+      unsigned &satisfied = walker.satisfied[i];
+      int &critical = walker.critical[i];
+      if (!satisfied) {
+        LOG (walker.clauses[i], "made");
+        walker.make (i);
+        walker.breaks[idx]++;
 #ifdef LOGGING
         made++;
 #endif
-        j--;
-
-      } else { // Otherwise the clause is not satisfied, undo shift.
-
-        for (int i = size - 1; i >= 0; i--) {
-          int other = literals[i];
-          literals[i] = prev;
-          prev = other;
-        }
+      } else if (satisfied == 1) {
+        assert (walker.breaks[abs (critical)]);
+        walker.breaks[abs (critical)]--;
       }
-
-      if (count--)
-        continue;
-
-      // Update these counters eagerly.  Otherwise if we delay the update
-      // until all clauses are traversed, interrupting the solver has a high
-      // chance of giving bogus statistics on the number of 'propagations'
-      // in 'walk', if it is interrupted in this loop.
-
-      count = ratio; // Starting counting down again.
-      walker.propagations++;
-      stats.propagations.walk++;
+      critical ^= lit;
+      satisfied++;
     }
     LOG ("made %" PRId64 " clauses by flipping %d", made, lit);
-    walker.broken.resize (j - walker.broken.begin ());
   }
 
-  // Finally add all new unsatisfied (broken) clauses.
+  // Finally update the clauses containing '-lit', which lose a true
+  // literal and might become unsatisfied (broken).
   {
-    walker.propagations++;     // This really corresponds now to one
-    stats.propagations.walk++; // propagation (in a one-watch scheme).
-
 #ifdef LOGGING
     int64_t broken = 0;
 #endif
-    Watches &ws = watches (-lit);
-
-    LOG ("trying to brake %zd watched clauses", ws.size ());
-
-    for (const auto &w : ws) {
-      Clause *d = w.clause;
-      LOG (d, "unwatch %d in", -lit);
-      int *literals = d->literals, replacement = 0, prev = -lit;
-      assert (literals[0] == -lit);
-      const int size = d->size;
-      for (int i = 1; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev; // shift all to right
-        prev = other;
-        const signed char tmp = val (other);
-        if (tmp < 0)
-          continue;
-        replacement = other; // satisfying literal
-        break;
-      }
-      if (replacement) {
-        literals[1] = -lit;
-        literals[0] = replacement;
-        assert (-lit != replacement);
-        watch_literal (replacement, -lit, d);
-      } else {
-        for (int i = size - 1; i > 0; i--) { // undo shift
-          const int other = literals[i];
-          literals[i] = prev;
-          prev = other;
-        }
-        assert (literals[0] == -lit);
-        LOG (d, "broken");
-        walker.broken.push_back (d);
+    const unsigned code = Walker::code (-lit);
+    const unsigned *const end = occs + offsets[code + 1];
+    for (const unsigned *p = occs + offsets[code]; p != end; p++) {
+      const unsigned i = *p;
+      unsigned &satisfied = walker.satisfied[i];
+      int &critical = walker.critical[i];
+      assert (satisfied);
+      critical ^= -lit;
+      if (!--satisfied) {
+        assert (!critical);
+        LOG (walker.clauses[i], "broken");
+        walker.brake (i);
+        assert (walker.breaks[idx]);
+        walker.breaks[idx]--;
 #ifdef LOGGING
         broken++;
 #endif
+      } else if (satisfied == 1) {
+        assert (val (critical) > 0);
+        walker.breaks[abs (critical)]++;
       }
     }
     LOG ("broken %" PRId64 " clauses by flipping %d", broken, lit);
-    ws.clear ();
   }
 }
 
@@ -415,8 +329,6 @@ int Internal::walk_round (int64_t limit, bool prev) {
 
   stats.walk.count++;
 
-  clear_watches ();
-
   // Remove all fixed variables first (assigned at decision level zero).
   //
   if (last.collect.fixed < stats.all.fixed)
@@ -516,10 +428,9 @@ int Internal::walk_round (int64_t limit, bool prev) {
       LOG ("initial assign %d to decision phase", tmp < 0 ? -idx : idx);
     }
 
-    LOG ("watching satisfied and registering broken clauses");
-#ifdef LOGGING
-    int64_t watched = 0;
-#endif
+    LOG ("counting true literals and registering broken clauses");
+    walker.breaks.resize (1 + (size_t) max_var, 0);
+    walker.offsets.resize (2 * (size_t) max_var + 3, 0);
     for (const auto c : clauses) {
 
       if (c->garbage)
@@ -532,24 +443,23 @@ int Internal::walk_round (int64_t limit, bool prev) {
       }
 
       bool satisfiable = false; // contains not only assumptions
-      int satisfied = 0;        // clause satisfied?
-
-      int *lits = c->literals;
-      const int size = c->size;
+      unsigned satisfied = 0;   // number of true literals
+      int critical = 0;         // 'xor' of true literals
 
-      // Move to front satisfied literals and determine whether there
-      // is at least one (non-assumed) literal that can be flipped.
+      // Count true literals and determine whether there is at least one
+      // (non-assumed) literal that can be flipped.  Only the occurrences
+      // of such literals are needed since assumptions are never flipped.
       //
-      for (int i = 0; satisfied < 2 && i < size; i++) {
-        const int lit = lits[i];
+      for (const auto lit : *c) {
         assert (active (lit)); // Due to garbage collection.
         if (val (lit) > 0) {
-          swap (lits[satisfied], lits[i]);
-          if (!satisfied++)
-            LOG ("first satisfying literal %d", lit);
-        } else if (!satisfiable && var (lit).level > 1) {
-          LOG ("non-assumption potentially satisfying literal %d", lit);
-          satisfiable = true;
+          satisfied++;
+          critical ^= lit;
+        }
+        if (var (lit).level > 1) {
+          walker.offsets[Walker::code (lit) + 1]++;
+          if (val (lit) < 0)
+            satisfiable = true;
         }
       }
 
@@ -560,26 +470,42 @@ int Internal::walk_round (int64_t limit, bool prev) {
         break;
       }
 
-      if (satisfied) {
-        watch_literal (lits[0], lits[1], c);
-#ifdef LOGGING
-        watched++;
-#endif
-      } else {
+      const unsigned i = walker.clauses.size ();
+      walker.clauses.push_back (c);
+      walker.satisfied.push_back (satisfied);
+      walker.critical.push_back (critical);
+      walker.position.push_back ((unsigned) Walker::invalid_position);
+
+      if (!satisfied) {
         assert (satisfiable); // at least one non-assumed variable ...
         LOG (c, "broken");
-        walker.broken.push_back (c);
-      }
+        walker.brake (i);
+      } else if (satisfied == 1)
+        walker.breaks[abs (critical)]++;
     }
-#ifdef LOGGING
+
+    // Now connect the occurrences of literals in the considered clauses
+    // stored consecutively for each literal in 'occs'.
+    //
     if (!failed) {
-      int64_t broken = walker.broken.size ();
-      int64_t total = watched + broken;
-      LOG ("watching %" PRId64 " clauses %.0f%% "
-           "out of %" PRId64 " (watched and broken)",
-           watched, percent (watched, total), total);
+      auto &offsets = walker.offsets;
+      for (size_t i = 1; i < offsets.size (); i++)
+        offsets[i] += offsets[i - 1];
+      walker.occs.resize (offsets.back ());
+      vector<unsigned> next (offsets);
+      for (unsigned i = 0; i < walker.clauses.size (); i++)
+        for (const auto lit : *walker.clauses[i])
+          if (var (lit).level > 1)
+            walker.occs[next[Walker::code (lit)]++] = i;
+      LOG ("%zd clauses with %zd occurrences of which %zd broken",
+           walker.clauses.size (), walker.occs.size (),
+           walker.broken.size ());
+
+      // Building the occurrences is charged to the effort limit too.
+      //
+      walker.propagations += walker.occs.size ();
+      stats.propagations.walk += walker.occs.size ();
     }
-#endif
   }
 
   int64_t old_global_minimum = stats.walk.minimum;
@@ -667,9 +593,6 @@ int Internal::walk_round (int64_t limit, bool prev) {
   assert (level == 2);
   level = 0;
 
-  clear_watches ();
-  connect_watches ();
-
 #ifndef QUIET
   if (localsearching) {
     assert (force_phase_messages);
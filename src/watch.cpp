@@ -103,4 +103,54 @@ void Internal::sort_watches () {
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+// Remove tombstones (see 'bury_watch') from the watch list of 'lit' in one
+// pass.  This also updates watches of clauses which became binary in the
+// meantime, which allows 'decompose' to just mark such watch lists with
+// 'mark_tombstoned' instead of searching for the watches of each clause.
+
+void Internal::flush_tombstones (int lit) {
+  Flags &f = flags (lit);
+  f.buried &= ~bign (lit);
+  Watches &ws = watches (lit);
+  const auto end = ws.end ();
+  auto j = ws.begin ();
+  bool binaries = false;
+  for (auto i = j; i != end; i++) {
+    Watch &w = *j++ = *i;
+    if (w.binary ())
+      continue;
+    Clause *c = watched_clause (w);
+    const int *lits = c->literals;
+    if (lits[0] != lit && lits[1] != lit) {
+      stats.tombstones.flushed++;
+      j--;
+    } else if (c->size == 2 && !c->garbage) {
+      update_watch (w, c);
+      w.blit = lits[0] ^ lits[1] ^ lit;
+      binaries = true;
+    }
+  }
+  ws.resize (j - ws.begin ());
+  if (binaries) {
+    auto k = ws.begin ();
+    for (auto i = k; i != ws.end (); i++)
+      if (i->binary ())
+        swap (*k++, *i);
+  }
+}
+
+void Internal::flush_tombstones () {
+  if (tombstoned.empty ())
+    return;
+  LOG ("flushing tombstones in %zd watch lists", tombstoned.size ());
+  for (const auto &lit : tombstoned)
+    flush_tombstones (lit);
+  tombstoned.clear ();
+  for (const auto &c : buried)
+    c->buried = false;
+  buried.clear ();
+}
+
 } // namespace CaDiCaL
@@ -15,6 +15,16 @@ namespace CaDiCaL {
 // to use at least one more bit (either taken away from the variable space
 // or the clauses) to denote whether the watch is binary.
 
+// This alternative is available by compiling with '-DCOMPACTWATCHES' (see
+// '--compact-watches' in '../configure').  Then watches are only 8 bytes
+// and use a 32-bit reference into the arena (see 'arena.hpp'), where bit 0
+// marks binary clauses.  In both cases the clause of a watch 'w' has to be
+// accessed through 'watched_clause (w)' of 'Internal'.
+
+// Binary watches are kept in front of the watches of larger clauses (see
+// 'watch_literal' and 'flush_watches') which allows 'propagate' to
+// propagate all binary clauses first.
+
 // in fashion of Intel Sat 10.4230/LIPIcs.SAT.2022.8 we try to
 // guarantee the following invariant:
 // For both watches:
@@ -26,6 +36,8 @@ namespace CaDiCaL {
 
 struct Clause;
 
+#ifndef COMPACTWATCHES
+
 struct Watch {
 
   Clause *clause;
@@ -38,35 +50,26 @@ struct Watch {
   bool binary () const { return size == 2; }
 };
 
+#else
+
+struct Watch {
+
+  int blit;
+  unsigned ref; // see 'Arena::reference' (bit 0 marks binary clauses)
+
+  Watch (int b, unsigned r) : blit (b), ref (r) {}
+  Watch () {}
+
+  bool binary () const { return ref & 1; }
+};
+
+#endif
+
 typedef vector<Watch> Watches; // of one literal
 
 typedef Watches::iterator watch_iterator;
 typedef Watches::const_iterator const_watch_iterator;
 
-inline void remove_watch (Watches &ws, Clause *clause) {
-  const auto end = ws.end ();
-  auto i = ws.begin ();
-  for (auto j = i; j != end; j++) {
-    const Watch &w = *i++ = *j;
-    if (w.clause == clause)
-      i--;
-  }
-  assert (i + 1 == end);
-  ws.resize (i - ws.begin ());
-}
-
-// search for the clause and updates the size marked in the watch lists
-inline void update_watch_size (Watches &ws, int blit, Clause *conflict) {
-  bool found = false;
-  const int size = conflict->size;
-  for (Watch &w : ws) {
-    if (w.clause == conflict)
-      w.size = size, w.blit = blit, found = true;
-    assert (w.clause->garbage || w.size == 2 || w.clause->size != 2);
-  }
-  assert (found), (void) found;
-}
-
 } // namespace CaDiCaL
 
 #endif
@@ -0,0 +1,58 @@
+// Benchmarks the radix sort 'rsort' in 'src/radix.hpp' against
+// 'stable_sort' on rank distributions as they occur in the solver.  This
+// is only compiled by 'run.sh' but not executed.  Call the binary
+// 'test-internal-radixbench' in the build directory to get the timings
+// (preferably with a build configured without assertion checking).
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "radix.hpp"
+#include "radixranks.hpp"
+
+using namespace std;
+using namespace CaDiCaL;
+
+static double seconds () {
+  using namespace chrono;
+  const auto now = steady_clock::now ().time_since_epoch ();
+  return duration_cast<duration<double>> (now).count ();
+}
+
+template <class T, class Rank>
+static void bench (const char *name, const vector<T> &input) {
+  const int rounds = input.size () < 10000 ? 1000 : 20;
+  vector<T> sorted;
+  double std_time = 0, radix_time = 0;
+  for (int round = 0; round < rounds; round++) {
+    sorted = input;
+    double start = seconds ();
+    stable_sort (sorted.begin (), sorted.end (), rank_smaller<Rank> ());
+    std_time += seconds () - start;
+    sorted = input;
+    start = seconds ();
+    rsort (sorted.begin (), sorted.end (), Rank ());
+    radix_time += seconds () - start;
+  }
+  printf ("%-20s %8zu elements %10.3f ms stable_sort %10.3f ms rsort "
+          "%6.2fx\n",
+          name, input.size (), 1e3 * std_time / rounds,
+          1e3 * radix_time / rounds,
+          radix_time > 0 ? std_time / radix_time : 0.0);
+  fflush (stdout);
+}
+
+int main () {
+  for (auto n : {100, 1000, 100000, 1000000}) {
+    bench<int, bumped_rank> ("enqueued", analyzed_variables (n, false));
+    bench<int, bumped_rank> ("enqueued (sorted)",
+                             analyzed_variables (n, true));
+    const vector<Key> keys = reduce_candidates (n);
+    bench<Key, key_rank64> ("glue/size (64-bit)", keys);
+    bench<Key, key_rank32> ("glue/size (32-bit)", keys);
+  }
+  return 0;
+}
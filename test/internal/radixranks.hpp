@@ -0,0 +1,96 @@
+#ifndef _radixranks_hpp_INCLUDED
+#define _radixranks_hpp_INCLUDED
+
+// Rank distributions as they occur in the solver, shared by the radix sort
+// test 'radixsort' and the benchmark 'radixbench'.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+static uint64_t state = 42;
+
+static uint64_t next () {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+static unsigned pick (unsigned l, unsigned r) {
+  return l + next () % (r - l + 1);
+}
+
+// Bumping sorts analyzed variables by their 'enqueued' time stamps, which
+// are large 64-bit numbers spread over a small range.
+
+static std::vector<uint64_t> btab;
+
+struct bumped_rank {
+  typedef uint64_t Type;
+  Type operator() (int idx) const { return btab[idx]; }
+};
+
+struct bumped_smaller {
+  bool operator() (int a, int b) const {
+    return bumped_rank () (a) < bumped_rank () (b);
+  }
+};
+
+// Reduce sorts clauses by glue and size (here with 32-bit and 64-bit keys)
+// and 'analyze' sorts literals by level and trail position.
+
+struct Key {
+  unsigned glue, size;
+};
+
+struct key_rank64 {
+  typedef uint64_t Type;
+  Type operator() (const Key &k) const {
+    return ~(((uint64_t) k.glue << 32) | k.size);
+  }
+};
+
+struct key_rank32 {
+  typedef unsigned Type;
+  Type operator() (const Key &k) const { return (k.glue << 16) | k.size; }
+};
+
+template <class Rank> struct rank_smaller {
+  template <class T> bool operator() (const T &a, const T &b) const {
+    return Rank () (a) < Rank () (b);
+  }
+};
+
+// Generates 'n' analyzed variables (indices into 'btab') optionally
+// already sorted by their stamps.
+
+static std::vector<int> analyzed_variables (size_t n, bool presorted) {
+  const size_t vars = 4 * n;
+  btab.resize (vars);
+  uint64_t stamp = (uint64_t) 1 << 34;
+  for (auto &b : btab)
+    b = stamp++;
+  std::vector<int> analyzed;
+  for (size_t i = 0; i < n; i++)
+    analyzed.push_back (pick (0, vars - 1));
+  if (presorted)
+    std::sort (analyzed.begin (), analyzed.end (), bumped_smaller ());
+  return analyzed;
+}
+
+// Generates 'n' glue and size pairs of reduction candidates, where small
+// glues are much more frequent than large ones.
+
+static std::vector<Key> reduce_candidates (size_t n) {
+  std::vector<Key> keys;
+  for (size_t i = 0; i < n; i++) {
+    Key k;
+    k.glue = pick (2, pick (2, 60));
+    k.size = pick (k.glue + 1, k.glue + 200);
+    keys.push_back (k);
+  }
+  return keys;
+}
+
+#endif
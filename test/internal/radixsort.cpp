@@ -0,0 +1,64 @@
+// Checks the radix sort 'rsort' in 'src/radix.hpp' against 'stable_sort'
+// on rank distributions as they occur in the solver.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+
+#include "radix.hpp"
+#include "radixranks.hpp"
+
+using namespace std;
+using namespace CaDiCaL;
+
+template <class T, class Rank> static void check (const vector<T> &input) {
+  vector<T> expected = input, actual = input;
+  stable_sort (expected.begin (), expected.end (), rank_smaller<Rank> ());
+  rsort (actual.begin (), actual.end (), Rank ());
+  for (size_t i = 0; i < input.size (); i++)
+    assert (Rank () (actual[i]) == Rank () (expected[i]));
+}
+
+static void bumping (size_t n, bool presorted) {
+  check<int, bumped_rank> (analyzed_variables (n, presorted));
+}
+
+static void reducing (size_t n) {
+  const vector<Key> keys = reduce_candidates (n);
+  check<Key, key_rank64> (keys);
+  check<Key, key_rank32> (keys);
+}
+
+static void stability () {
+  vector<Key> keys;
+  for (unsigned i = 0; i < 5000; i++) {
+    Key k;
+    k.glue = pick (2, 4);
+    k.size = i;
+    keys.push_back (k);
+  }
+  struct glue_rank {
+    typedef unsigned Type;
+    Type operator() (const Key &k) const { return k.glue; }
+  };
+  rsort (keys.begin (), keys.end (), glue_rank ());
+  for (size_t i = 1; i < keys.size (); i++)
+    assert (keys[i - 1].glue < keys[i].glue ||
+            keys[i - 1].size < keys[i].size);
+}
+
+int main () {
+  stability ();
+  for (auto n : {100, 1000, 100000}) {
+    bumping (n, false);
+    bumping (n, true);
+    reducing (n);
+  }
+  return 0;
+}